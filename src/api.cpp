@@ -2,6 +2,9 @@
 #include "constants.h"
 #include "deserialization.h"
 #include "multiexp.h"
+#include "fixed_base.h"
+#include "base_set.h"
+#include "endomorphism.h"
 #include "extension_towers/fp4.h"
 #include "pairings/mnt4.h"
 #include "pairings/mnt6.h"
@@ -18,10 +21,11 @@ There are no magic/hacks here, only templates.
 
 // Executes non-pairing operation with given extension degree
 template <usize N, class F, class C>
-std::vector<std::uint8_t> run_operation_extension(u8 operation, u8 mod_byte_len, C const &extension, u8 extension_degree, Deserializer deserializer)
+std::vector<std::uint8_t> run_operation_extension(u8 operation, u8 mod_byte_len, C const &extension, u8 extension_degree, Deserializer deserializer, bool register_bases)
 {
     // Weierstrass curve
-    auto const wc = deserialize_weierstrass_curve<F>(mod_byte_len, extension, deserializer, false);
+    auto wc = deserialize_weierstrass_curve<F>(mod_byte_len, extension, deserializer, false);
+    detect_endomorphism(wc, extension);
 
     // Run the operation for the result
     std::vector<u8> result;
@@ -36,10 +40,19 @@ std::vector<std::uint8_t> run_operation_extension(u8 operation, u8 mod_byte_len,
         auto const p_1 = deserialize_curve_point<F>(mod_byte_len, extension, wc, deserializer);
 
         // Apply addition
-        p_0.add(p_1, wc, extension);
+        Option<CurvePoint<F>> sum;
+        if (deserializer.complete_formulas())
+        {
+            sum = ProjectivePoint<F>::sum(p_0, p_1, wc);
+        }
+        if (!sum)
+        {
+            p_0.add(p_1, wc, extension);
+            sum = p_0;
+        }
 
         // seri Result
-        p_0.serialize(mod_byte_len, result);
+        sum.value().serialize(mod_byte_len, result);
         break;
     }
     // Multiplication
@@ -48,13 +61,22 @@ std::vector<std::uint8_t> run_operation_extension(u8 operation, u8 mod_byte_len,
     {
         // deser CurvePoint & Scalar
         auto const p_0 = deserialize_curve_point<F>(mod_byte_len, extension, wc, deserializer);
+        auto const base_key = deserializer.consumed();
         auto const scalar = deserialize_scalar(wc, deserializer);
 
-        // Apply multiplication
-        auto r = p_0.mul(scalar, wc, extension);
+        // Apply multiplication, with a precomputed table if the same base comes often
+        Option<CurvePoint<F>> r;
+        if (deserializer.complete_formulas())
+        {
+            r = ProjectivePoint<F>::product(p_0, scalar, wc);
+        }
+        if (!r)
+        {
+            r = mul_fixed_base(base_key, p_0, scalar, wc, extension);
+        }
 
         // seri Result
-        r.serialize(mod_byte_len, result);
+        r.value().serialize(mod_byte_len, result);
         break;
     }
     // Multiexponentiation
@@ -69,25 +91,74 @@ std::vector<std::uint8_t> run_operation_extension(u8 operation, u8 mod_byte_len,
         }
 
         // Check if remaining input size is exact
-        u32 const expected_pair_len = 2 * extension_degree * mod_byte_len + wc.order_len();
-        if (deserializer.remaining() != expected_pair_len)
+        u32 const expected_pair_len = curve_point_length(mod_byte_len, extension_degree, deserializer) + wc.order_len();
+        if (deserializer.remaining() != num_pairs * expected_pair_len)
         {
             input_err("Input length is invalid for number of pairs");
         }
 
+        // Curve and points without scalars identify a registered base set
+        auto bases_key = deserializer.consumed();
+        std::vector<std::string> point_keys;
         std::vector<std::tuple<CurvePoint<F>, std::vector<u64>>> pairs;
         for (auto i = 0; i < num_pairs; i++)
         {
+            auto const point_start = deserializer.position();
             auto const p = deserialize_curve_point<F>(mod_byte_len, extension, wc, deserializer);
+            point_keys.push_back(deserializer.consumed(point_start));
+            bases_key += point_keys.back();
             auto const scalar = deserialize_scalar(wc, deserializer);
             pairs.push_back(tuple(p, scalar));
         }
 
-        // Apply Multiexponentiation
-        auto const r = peepinger(pairs, wc, extension);
+        if (register_bases)
+        {
+            register_base_set(bases_key, pairs, wc);
+            break;
+        }
+
+        // Points of a registered base set come with their tables, the complete formulas don't use them
+        if (!deserializer.complete_formulas())
+        {
+            if (auto const base_set_r = base_set_multiexp(bases_key, pairs, wc, extension))
+            {
+                base_set_r.value().serialize(mod_byte_len, result);
+                break;
+            }
+        }
+
+        // Nothing is left to add after dropping zero scalars and merging repeated points
+        auto const unique_pairs = coalesce_pairs(pairs, point_keys);
+        if (unique_pairs.empty())
+        {
+            CurvePoint<F>::zero(extension).serialize(mod_byte_len, result);
+            break;
+        }
+
+        // Apply Multiexponentiation, with the algorithm that is fastest for the number of pairs left
+        Option<CurvePoint<F>> r;
+        if (deserializer.complete_formulas())
+        {
+            r = complete_multiexp(unique_pairs, wc, extension);
+        }
+        if (!r)
+        {
+            if (unique_pairs.size() == 1)
+            {
+                r = std::get<0>(unique_pairs[0]).mul(std::get<1>(unique_pairs[0]), wc, extension);
+            }
+            else if (unique_pairs.size() <= MAX_STRAUS_MULTIEXP_PAIRS)
+            {
+                r = straus(unique_pairs, wc, extension);
+            }
+            else
+            {
+                r = peepinger(unique_pairs, wc, extension);
+            }
+        }
 
         // seri Result
-        r.serialize(mod_byte_len, result);
+        r.value().serialize(mod_byte_len, result);
         break;
     }
     default:
@@ -103,7 +174,7 @@ template <class ENGINE, usize N>
 std::vector<std::uint8_t> run_pairing_b(u8 mod_byte_len, PrimeField<N> const &field, usize max_u_bit_length, Deserializer deserializer)
 {
     // Deser Weierstrass 1 & Extension2
-    auto const g1_curve = deserialize_weierstrass_curve<Fp<N>>(mod_byte_len, field, deserializer, true);
+    auto g1_curve = deserialize_weierstrass_curve<Fp<N>>(mod_byte_len, field, deserializer, true);
     auto const extension2 = FieldExtension2(deserialize_non_residue<Fp<N>>(mod_byte_len, field, 2, deserializer), field);
 
     // Deser Extension6 & TwistType
@@ -139,20 +210,22 @@ std::vector<std::uint8_t> run_pairing_b(u8 mod_byte_len, PrimeField<N> const &fi
     }
     }
     auto const a_fp2 = Fp2<N>::zero(extension2);
-    auto const g2_curve = WeierstrassCurve(a_fp2, b_fp2, g1_curve.subgroup_order(), g1_curve.order_len());
+    auto g2_curve = WeierstrassCurve(a_fp2, b_fp2, g1_curve.subgroup_order(), g1_curve.order_len());
 
     // Decode u and it's sign
     auto const u = deserialize_scalar_with_bit_limit(max_u_bit_length, deserializer);
     auto const u_is_negative = deserialize_sign(deserializer);
 
-    // deser (CurvePoint<Fp<N>>,CurvePoint<F>) pairs
-    auto const points = deserialize_points<N, Fp2<N>>(mod_byte_len, extension2, g1_curve, g2_curve, deserializer);
-
     // Construct BN engine
     ENGINE const engine(u, u_is_negative, twist_type, g2_curve, e6_non_residue);
+    engine.set_subgroup_tests(g1_curve, g2_curve, extension2, e6_non_residue);
+
+    // deser (CurvePoint<Fp<N>>,CurvePoint<F>) pairs
+    std::vector<std::string> g2_keys;
+    auto const points = deserialize_points<N, Fp2<N>>(mod_byte_len, extension2, g1_curve, g2_curve, deserializer, g2_keys);
 
     // Execute pairing
-    auto const opairing_result = engine.pair(points, extension12);
+    auto const opairing_result = engine.pair(points, g2_keys, extension12);
     if (!opairing_result)
     {
         unknown_parameter_err("Pairing engine returned no value");
@@ -177,7 +250,7 @@ template <class F, class F2, class FEO, class FE, class ENGINE, usize N>
 std::vector<std::uint8_t> run_pairing_mnt(u8 mod_byte_len, PrimeField<N> const &field, u8 extension_degree, Deserializer deserializer)
 {
     // Deser Weierstrass 1 & Extension
-    auto const g1_curve = deserialize_weierstrass_curve<Fp<N>>(mod_byte_len, field, deserializer, true);
+    auto const g1_curve = deserialize_weierstrass_curve<Fp<N>>(mod_byte_len, field, deserializer, false);
     auto const extension = FE(deserialize_non_residue<Fp<N>>(mod_byte_len, field, extension_degree * 2, deserializer), field);
 
     // Construct Extension 2
@@ -217,13 +290,14 @@ std::vector<std::uint8_t> run_pairing_mnt(u8 mod_byte_len, PrimeField<N> const &
     auto const exp_w0_is_negative = deserialize_sign(deserializer);
 
     // deser (CurvePoint<Fp<N>>,CurvePoint<F>) pairs
-    auto const points = deserialize_points<N, F>(mod_byte_len, extension, g1_curve, g2_curve, deserializer);
+    std::vector<std::string> g2_keys;
+    auto const points = deserialize_points<N, F>(mod_byte_len, extension, g1_curve, g2_curve, deserializer, g2_keys);
 
     // Construct MNT engine
     ENGINE const engine(x, x_is_negative, exp_w0, exp_w1, exp_w0_is_negative, g2_curve, twist);
 
     // Execute pairing
-    auto const opairing_result = engine.pair(points, extension_2);
+    auto const opairing_result = engine.pair(points, g2_keys, extension_2);
     if (!opairing_result)
     {
         unknown_parameter_err("Pairing engine returned no value");
@@ -246,7 +320,7 @@ std::vector<std::uint8_t> run_pairing_mnt(u8 mod_byte_len, PrimeField<N> const &
 
 // Executes operation with known limb length
 template <usize N>
-std::vector<std::uint8_t> run_operation(u8 operation, std::optional<u8> curve_type, u8 mod_byte_len, Deserializer deserializer)
+std::vector<std::uint8_t> run_operation(u8 operation, std::optional<u8> curve_type, u8 mod_byte_len, Deserializer deserializer, bool register_bases)
 {
     // deser Modulus -> Field
     auto const modulus = deserialize_modulus<N>(mod_byte_len, deserializer);
@@ -293,21 +367,21 @@ std::vector<std::uint8_t> run_operation(u8 operation, std::optional<u8> curve_ty
         {
         case 1:
         {
-            return run_operation_extension<N, Fp<N>>(operation, mod_byte_len, field, extension_degree, deserializer);
+            return run_operation_extension<N, Fp<N>>(operation, mod_byte_len, field, extension_degree, deserializer, register_bases);
         }
         case 2:
         {
             // deser Extension
             FieldExtension2<N> const extension(deserialize_non_residue<Fp<N>>(mod_byte_len, field, extension_degree, deserializer), field);
 
-            return run_operation_extension<N, Fp2<N>>(operation, mod_byte_len, extension, extension_degree, deserializer);
+            return run_operation_extension<N, Fp2<N>>(operation, mod_byte_len, extension, extension_degree, deserializer, register_bases);
         }
         case 3:
         {
             // deser Extension
             FieldExtension3<N> const extension(deserialize_non_residue<Fp<N>>(mod_byte_len, field, extension_degree, deserializer), field);
 
-            return run_operation_extension<N, Fp3<N>>(operation, mod_byte_len, extension, extension_degree, deserializer);
+            return run_operation_extension<N, Fp3<N>>(operation, mod_byte_len, extension, extension_degree, deserializer, register_bases);
         }
 
         default:
@@ -316,7 +390,7 @@ std::vector<std::uint8_t> run_operation(u8 operation, std::optional<u8> curve_ty
     }
 }
 
-std::vector<std::uint8_t> run_limbed(u8 operation, std::optional<u8> curve_type, Deserializer deserializer)
+std::vector<std::uint8_t> run_limbed(u8 operation, std::optional<u8> curve_type, Deserializer deserializer, bool register_bases)
 {
     // Deserialize modulus length
     auto mod_byte_len = deserializer.byte("Input is not long enough to get modulus length");
@@ -333,37 +407,84 @@ std::vector<std::uint8_t> run_limbed(u8 operation, std::optional<u8> curve_type,
     case 2:
     case 3:
     case 4:
-        return run_operation<4>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<4>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 5:
-        return run_operation<5>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<5>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 6:
-        return run_operation<6>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<6>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 7:
-        return run_operation<7>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<7>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 8:
-        return run_operation<8>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<8>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 9:
-        return run_operation<9>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<9>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 10:
-        return run_operation<10>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<10>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 11:
-        return run_operation<11>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<11>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 12:
-        return run_operation<12>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<12>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 13:
-        return run_operation<13>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<13>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 14:
-        return run_operation<14>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<14>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 15:
-        return run_operation<15>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<15>(operation, curve_type, mod_byte_len, deserializer, register_bases);
     case 16:
-        return run_operation<16>(operation, curve_type, mod_byte_len, deserializer);
+        return run_operation<16>(operation, curve_type, mod_byte_len, deserializer, register_bases);
 
     default:
         unimplemented(stringf("for %u modulus limbs", limb_count));
     }
 }
 
+void set_fixed_base_cache_budget(std::size_t bytes)
+{
+    TableCache::fixed_bases().set_budget(bytes);
+}
+
+void set_prepared_g2_cache_budget(std::size_t bytes)
+{
+    TableCache::prepared_g2().set_budget(bytes);
+}
+
+std::optional<std::basic_string<char>> register_multiexp_bases(std::vector<std::uint8_t> const &input)
+{
+    try
+    {
+        auto deserializer = Deserializer(input);
+        auto operation = deserialize_operation(deserializer);
+        switch (operation)
+        {
+        case OPERATION_G1_MULTIEXP:
+        case OPERATION_G2_MULTIEXP:
+            run_limbed(operation, {}, deserializer, true);
+            return {};
+
+        default:
+            input_err("Only multiexp bases can be registered");
+        }
+    }
+    catch (std::domain_error const &e)
+    {
+        return e.what();
+    }
+    catch (std::runtime_error const &e)
+    {
+        return e.what();
+    }
+}
+
+std::size_t multiexp_bases_memory()
+{
+    return TableCache::base_sets().memory();
+}
+
+void set_multiexp_bases_budget(std::size_t bytes)
+{
+    TableCache::base_sets().set_budget(bytes);
+}
+
 // Main API function which receives ABI input and returns the result of operations, or description of occured error.
 std::variant<std::vector<std::uint8_t>, std::basic_string<char>>
 run(std::vector<std::uint8_t> const &input)
@@ -372,13 +493,17 @@ run(std::vector<std::uint8_t> const &input)
     {
         // Deserialize operation
         auto deserializer = Deserializer(input);
-        auto operation = deserializer.byte("Input should be longer than operation type encoding");
+        auto operation = deserialize_operation(deserializer);
 
         std::optional<u8> curve_type;
         switch (operation)
         {
         case OPERATION_PAIRING:
-            deserialize_pairing_curve_type(deserializer);
+            if (deserializer.complete_formulas())
+            {
+                input_err("Complete formulas are not used for pairings");
+            }
+            curve_type = deserialize_pairing_curve_type(deserializer);
             // Intentional fall through
         case OPERATION_G1_ADD:
         case OPERATION_G1_MUL:
@@ -386,7 +511,7 @@ run(std::vector<std::uint8_t> const &input)
         case OPERATION_G2_ADD:
         case OPERATION_G2_MUL:
         case OPERATION_G2_MULTIEXP:
-            return run_limbed(operation, curve_type, deserializer);
+            return run_limbed(operation, curve_type, deserializer, false);
 
         default:
             input_err("Unknown operation type");
@@ -1,6 +1,7 @@
 #ifndef H_API
 #define H_API
 
+#include <optional>
 #include <variant>
 #include <vector>
 #include <string>
@@ -8,4 +9,22 @@
 // Main API function for ABI.
 std::variant<std::vector<std::uint8_t>, std::basic_string<char>> run(std::vector<std::uint8_t> const &input);
 
+// Memory in bytes for tables of often multiplied base points, 0 disables them.
+void set_fixed_base_cache_budget(std::size_t bytes);
+
+// Memory in bytes for line coefficients of pairing G2 points, 0 disables them.
+// Later pairings with the same curves and G2 point, byte for byte, skip its subgroup check and preparation.
+void set_prepared_g2_cache_budget(std::size_t bytes);
+
+// Precomputes for the points of a G1 or G2 multiexp input, its scalars are ignored.
+// Later multiexp inputs with the same curve and points, byte for byte, skip doublings between windows.
+// Returns an error if the input is invalid or the precomputation goes over the cap.
+std::optional<std::basic_string<char>> register_multiexp_bases(std::vector<std::uint8_t> const &input);
+
+// Bytes taken by all registered base sets.
+std::size_t multiexp_bases_memory();
+
+// Cap in bytes for registered base sets, lowering it drops the least recently used ones.
+void set_multiexp_bases_budget(std::size_t bytes);
+
 #endif
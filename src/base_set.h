@@ -0,0 +1,146 @@
+#ifndef H_BASE_SET
+#define H_BASE_SET
+
+#include "common.h"
+#include "multiexp.h"
+#include "fixed_base.h"
+#include "table_cache.h"
+#include <memory>
+
+// Widest window of a base set, it takes 2^(c-1) buckets.
+static const u32 MAX_BASE_SET_WINDOW = 16;
+
+// Window width for a base set: all its digits go into one set of buckets, so a multiexp takes
+// n_points * n_windows additions into buckets and 2^c to sum them up.
+u32 base_set_window_width(usize n_points, usize n_bits)
+{
+    u32 best = 2;
+    usize best_cost = usize(-1);
+    for (u32 c = 2; c <= MAX_BASE_SET_WINDOW; c++)
+    {
+        auto const cost = n_points * (n_bits / c + 1) + (usize(1) << c);
+        if (cost < best_cost)
+        {
+            best = c;
+            best_cost = cost;
+        }
+    }
+
+    return best;
+}
+
+// Copies [2^(c*w)]P_i of every base for every c bit window w, so that the digits of all windows
+// share one set of buckets and no doublings are left between windows.
+template <class E>
+class BaseSetTable : public CachedTable
+{
+    u32 c;
+    usize n_points;
+    usize n_windows;
+    usize element_limbs;
+    // x and y of the copies, window by window
+    std::vector<u64> limbs;
+    std::vector<bool> zeros;
+
+public:
+    // Table for scalars of up to n_bits bits.
+    BaseSetTable(std::vector<CurvePoint<E>> const &bases, usize n_bits, WeierstrassCurve<E> const &wc) : c(base_set_window_width(bases.size(), n_bits)), n_points(bases.size()), n_windows(n_bits / c + 1), element_limbs(0)
+    {
+        std::vector<CurvePoint<E>> copies;
+        auto shifted = bases;
+        for (usize w = 0; w < n_windows; w++)
+        {
+            copies.insert(copies.end(), shifted.cbegin(), shifted.cend());
+            for (auto it = shifted.begin(); it != shifted.end(); it++)
+            {
+                for (u32 i = 0; i < c; i++)
+                {
+                    it->mul2(wc);
+                }
+            }
+        }
+        CurvePoint<E>::batch_normalize(copies);
+
+        for (auto it = copies.cbegin(); it != copies.cend(); it++)
+        {
+            zeros.push_back(it->is_zero());
+            detach(it->x, limbs);
+            detach(it->y, limbs);
+        }
+        element_limbs = limbs.size() / (2 * copies.size());
+    }
+
+    usize memory() const override
+    {
+        return limbs.size() * sizeof(u64) + zeros.size() / 8;
+    }
+
+    // None if scalars are longer than the table allows.
+    template <class C>
+    Option<CurvePoint<E>> multiexp(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc, C const &context) const
+    {
+        assert(pairs.size() == n_points);
+        auto const digits = recode_scalars(pairs, c);
+        if (digits.n_windows > n_windows)
+        {
+            return {};
+        }
+
+        // Copy of window w and base i is point w * n_points + i of a single window
+        DigitMatrix flat;
+        flat.c = c;
+        flat.n_windows = 1;
+        flat.n_points = digits.n_windows * n_points;
+        flat.digits = digits.digits;
+
+        auto const zero_point = CurvePoint<E>::zero(context);
+        std::vector<CurvePoint<E>> points;
+        for (usize k = 0; k < flat.n_points; k++)
+        {
+            if (zeros[k])
+            {
+                points.push_back(zero_point);
+                points.push_back(zero_point);
+                continue;
+            }
+
+            auto const at = limbs.data() + 2 * k * element_limbs;
+            points.push_back(CurvePoint<E>(attach(at, context), attach(at + element_limbs, context)));
+            points.push_back(points.back());
+            points.back().negate();
+        }
+
+        return bucket_sum(points, flat, wc, context);
+    }
+};
+
+// Precomputes for the bases of pairs, unless the cap on base sets would be exceeded.
+template <class E>
+void register_base_set(std::string const &key, std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc)
+{
+    std::vector<CurvePoint<E>> bases;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        bases.push_back(std::get<0>(*it));
+    }
+
+    auto const table = std::make_shared<BaseSetTable<E> const>(bases, num_bits(wc.subgroup_order()), wc);
+    if (!TableCache::base_sets().insert_if_fits(key, table))
+    {
+        api_err("Base set does not fit into the memory cap");
+    }
+}
+
+// Multiexp with the registered base set of key, if there is one.
+template <class E, class C>
+Option<CurvePoint<E>> base_set_multiexp(std::string const &key, std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc, C const &context)
+{
+    if (auto const table = std::dynamic_pointer_cast<BaseSetTable<E> const>(TableCache::base_sets().get(key)))
+    {
+        return table->multiexp(pairs, wc, context);
+    }
+
+    return {};
+}
+
+#endif
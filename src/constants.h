@@ -36,6 +36,17 @@ static const u8 OPERATION_G2_MULTIEXP = 0x06;
 
 static const u8 OPERATION_PAIRING = 0x07;
 
+// ************************** Opt-in encodings ***************************** //
+// Set in the operation byte, points are then encoded as a byte for the sign of y followed by x.
+static const u8 OPERATION_COMPRESSED_POINTS = 0x80;
+// Set in the operation byte, G1 and G2 addition, multiplication and multiexp use complete projective
+// formulas, which take no data dependent branches. Not for pairings.
+static const u8 OPERATION_COMPLETE_FORMULAS = 0x40;
+
+static const usize COMPRESSED_POINT_SIGN_LENGTH = 1;
+static const u8 COMPRESSED_POINT_SIGN_PLUS = 0x02;
+static const u8 COMPRESSED_POINT_SIGN_MINUS = 0x03;
+
 // ****************************** Sane Limits **************************** //
 static const usize MAX_BLS12_X_BIT_LENGTH = 512;
 static const usize MAX_BN_U_BIT_LENGTH = 512;
@@ -3,6 +3,8 @@
 
 #include "common.h"
 #include "repr.h"
+#include "element.h"
+#include <memory>
 
 enum CurveType
 {
@@ -12,6 +14,92 @@ enum CurveType
     BIsZero,
 };
 
+template <class E>
+class CurvePoint;
+
+// What is known of Z of a point, kept up to date by whatever writes Z.
+enum PointState
+{
+    // Z is zero
+    Infinity,
+    // Z is one
+    Affine,
+    // Z is anything
+    Jacobian,
+};
+
+template <class E>
+class WeierstrassCurve;
+
+// ****************************** ENDOMORPHISM ***************************** //
+// Efficiently computable endomorphism phi which acts on its eigenspace as phi(P) = [m]P.
+// Scalar k is then split into digits k_i in base m, so that [k]P = sum of [k_i]phi^i(P).
+// E: Element
+template <class E>
+class Endomorphism
+{
+protected:
+    std::vector<u64> m;
+    u32 dimension;
+
+public:
+    Endomorphism(std::vector<u64> m, u32 dimension) : m(m), dimension(dimension) {}
+
+    virtual ~Endomorphism() {}
+
+    // Returns P, phi(P), ..., phi^(dimension-1)(P), or nothing if P is not in the eigenspace.
+    virtual Option<std::vector<CurvePoint<E>>> orbit(CurvePoint<E> const &p, WeierstrassCurve<E> const &wc) const = 0;
+
+    // Splits multiplication of p by scalar into dimension shorter multiplications.
+    // Returns nothing if that doesn't pay off or p is not in the eigenspace.
+    Option<std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>>> split(CurvePoint<E> const &p, std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc) const
+    {
+        if (num_bits(scalar) <= num_bits(m))
+        {
+            return {};
+        }
+
+        auto const opoints = orbit(p, wc);
+        if (!opoints)
+        {
+            return {};
+        }
+        auto const points = opoints.value();
+
+        // Digits lowest first, the last one takes whatever is left
+        std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> pairs;
+        auto rest = scalar;
+        for (u32 i = 0; i < dimension; i++)
+        {
+            if (i + 1 == dimension)
+            {
+                pairs.push_back(std::tuple(points[i], rest));
+            }
+            else
+            {
+                auto quotient = div_rem(rest, m);
+                pairs.push_back(std::tuple(points[i], rest));
+                rest = quotient;
+            }
+        }
+
+        return pairs;
+    }
+};
+
+// ****************************** SUBGROUP TEST ***************************** //
+// Membership test for the main subgroup that is cheaper than multiplication by its order.
+// E: Element
+template <class E>
+class SubgroupTest
+{
+public:
+    virtual ~SubgroupTest() {}
+
+    virtual bool is_in_subgroup(CurvePoint<E> const &p, WeierstrassCurve<E> const &wc) const = 0;
+};
+
+// ****************************** CURVE ***************************** //
 // E: Element
 template <class E>
 class WeierstrassCurve
@@ -21,15 +109,26 @@ class WeierstrassCurve
     E b;
     std::vector<u64> subgroup_order_;
     u8 order_len_;
+    std::shared_ptr<Endomorphism<E> const> endomorphism_;
+    std::shared_ptr<SubgroupTest<E> const> subgroup_test_;
 
 public:
     WeierstrassCurve(E a, E b, std::vector<u64> subgroup_order, u8 order_len) : a(a), b(b), subgroup_order_(subgroup_order), order_len_(order_len)
     {
+        auto minus_three = a.one();
+        minus_three.mul2();
+        minus_three.add(a.one());
+        minus_three.negate();
+
         cty = CurveType::Generic;
         if (a.is_zero())
         {
             cty = CurveType::AIsZero;
         }
+        else if (a == minus_three)
+        {
+            cty = CurveType::AIsMinus3;
+        }
     }
 
     E const &get_a() const
@@ -61,6 +160,28 @@ public:
     {
         return cty;
     }
+
+    // Known endomorphism, if any.
+    Endomorphism<E> const *endomorphism() const
+    {
+        return endomorphism_.get();
+    }
+
+    void set_endomorphism(std::shared_ptr<Endomorphism<E> const> endomorphism)
+    {
+        endomorphism_ = endomorphism;
+    }
+
+    // Known subgroup test, if any.
+    SubgroupTest<E> const *subgroup_test() const
+    {
+        return subgroup_test_.get();
+    }
+
+    void set_subgroup_test(std::shared_ptr<SubgroupTest<E> const> subgroup_test)
+    {
+        subgroup_test_ = subgroup_test;
+    }
 };
 
 // ****************************** CURVE POINT ***************************** //
@@ -73,17 +194,21 @@ public:
     E x;
     E y;
     E z;
+    PointState state;
 
-    CurvePoint(E x, E y, E z) : x(x), y(y), z(z) {}
+    CurvePoint(E x, E y, E z) : x(x), y(y), z(z), state(PointState::Jacobian) {}
 
-    CurvePoint(E x, E y) : CurvePoint(x, y, x.one())
+    CurvePoint(E x, E y) : x(x), y(y), z(x.one()), state(PointState::Affine)
     {
     }
 
     template <class C>
     static CurvePoint<E> zero(C const &context)
     {
-        return CurvePoint(E::zero(context), E::one(context), E::zero(context));
+        auto zero = CurvePoint(E::zero(context), E::one(context), E::zero(context));
+        zero.state = PointState::Infinity;
+
+        return zero;
     }
 
     auto operator=(CurvePoint<E> const &other)
@@ -91,6 +216,7 @@ public:
         x = other.x;
         y = other.y;
         z = other.z;
+        state = other.state;
     }
 
     std::tuple<E, E> xy() const
@@ -127,11 +253,53 @@ public:
     template <class C>
     bool check_correct_subgroup(WeierstrassCurve<E> const &wc, C const &context) const
     {
+        if (auto const subgroup_test = wc.subgroup_test())
+        {
+            return subgroup_test->is_in_subgroup(*this, wc);
+        }
+
         auto const p = mul(wc.subgroup_order(), wc, context);
 
         return p.is_zero();
     }
 
+    // Jacobian coordinates: X1 * Z2^2 = X2 * Z1^2 and Y1 * Z2^3 = Y2 * Z1^3
+    bool operator==(CurvePoint<E> const &other) const
+    {
+        if (is_zero() || other.is_zero())
+        {
+            return is_zero() && other.is_zero();
+        }
+
+        auto z1_2 = z;
+        z1_2.square();
+        auto z2_2 = other.z;
+        z2_2.square();
+
+        auto x1 = x;
+        x1.mul(z2_2);
+        auto x2 = other.x;
+        x2.mul(z1_2);
+        if (x1 != x2)
+        {
+            return false;
+        }
+
+        auto y1 = y;
+        y1.mul(z2_2);
+        y1.mul(other.z);
+        auto y2 = other.y;
+        y2.mul(z1_2);
+        y2.mul(z);
+
+        return y1 == y2;
+    }
+
+    bool operator!=(CurvePoint<E> const &other) const
+    {
+        return !(*this == other);
+    }
+
     void serialize(u8 mod_byte_len, std::vector<u8> &data) const
     {
         auto const pair = xy();
@@ -141,12 +309,22 @@ public:
 
     bool is_zero() const
     {
-        return z.is_zero();
+        switch (state)
+        {
+        case PointState::Infinity:
+            return true;
+
+        case PointState::Affine:
+            return false;
+
+        default:
+            return z.is_zero();
+        }
     }
 
     bool is_normalized() const
     {
-        if (is_zero())
+        if (state != PointState::Jacobian || is_zero())
         {
             return true;
         }
@@ -156,6 +334,45 @@ public:
         return z == one;
     }
 
+    // Normalizes all points with one shared inversion (Montgomery's trick).
+    static void batch_normalize(std::vector<CurvePoint<E>> &points)
+    {
+        std::vector<usize> indexes;
+        std::vector<E> z_invs;
+        for (usize i = 0; i < points.size(); i++)
+        {
+            if (!points[i].is_normalized())
+            {
+                indexes.push_back(i);
+                z_invs.push_back(points[i].z);
+            }
+        }
+
+        if (!batch_inverse(z_invs))
+        {
+            return;
+        }
+
+        for (usize k = 0; k < indexes.size(); k++)
+        {
+            auto &point = points[indexes[k]];
+            auto const &z_inv = z_invs[k];
+
+            auto zinv_powered = z_inv;
+            zinv_powered.square();
+
+            // X/Z^2
+            point.x.mul(zinv_powered);
+
+            // Y/Z^3
+            zinv_powered.mul(z_inv);
+            point.y.mul(zinv_powered);
+
+            point.z = point.x.one();
+            point.state = PointState::Affine;
+        }
+    }
+
     void negate()
     {
         if (!is_zero())
@@ -166,6 +383,11 @@ public:
 
     void mul2(WeierstrassCurve<E> const &wc)
     {
+        if (this->is_zero())
+        {
+            return;
+        }
+
         switch (wc.ctype())
         {
         case CurveType::Generic:
@@ -176,14 +398,34 @@ public:
             this->mul2_a_is_zero();
             break;
 
+        case CurveType::AIsMinus3:
+            this->mul2_a_is_minus_3();
+            break;
+
         default:
             unimplemented("");
         }
+        this->state = PointState::Jacobian;
     }
 
     // Returnes multiple of this by a scalar.
     template <class C>
     CurvePoint<E> mul(std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc, C const &context) const
+    {
+        if (auto const endomorphism = wc.endomorphism())
+        {
+            if (auto const pairs = endomorphism->split(*this, scalar, wc))
+            {
+                return CurvePoint<E>::mul_simultaneous(pairs.value(), wc, context);
+            }
+        }
+
+        return mul_generic(scalar, wc, context);
+    }
+
+    // Returnes multiple of this by a scalar, with plain double-and-add.
+    template <class C>
+    CurvePoint<E> mul_generic(std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc, C const &context) const
     {
         // Not using this is less performant, but for now it is simplier.
         // if (z == x.one())
@@ -214,6 +456,56 @@ public:
         return res;
     }
 
+    // Returnes sum of point multiples, sharing doublings between them (Shamir's trick).
+    // Intended for few pairs, as it precomputes all 2^n subset sums of points.
+    template <class C>
+    static CurvePoint<E> mul_simultaneous(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc, C const &context)
+    {
+        auto const n = pairs.size();
+        assert(n < 8);
+
+        // table[i] is the sum of points whose bit is set in i
+        std::vector<CurvePoint<E>> table(usize(1) << n, CurvePoint<E>::zero(context));
+        u32 n_bits = 0;
+        for (usize i = 0; i < n; i++)
+        {
+            auto const bit = usize(1) << i;
+            table[bit] = std::get<0>(pairs[i]);
+            for (usize j = 1; j < bit; j++)
+            {
+                table[bit | j] = table[j];
+                table[bit | j].add(table[bit], wc, context);
+            }
+            n_bits = max(n_bits, num_bits(std::get<1>(pairs[i])));
+        }
+        CurvePoint<E>::batch_normalize(table);
+
+        auto res = CurvePoint<E>::zero(context);
+        for (auto b = n_bits; b > 0; b--)
+        {
+            res.mul2(wc);
+
+            usize index = 0;
+            auto const limb = (b - 1) / LIMB_BITS;
+            auto const off = (b - 1) % LIMB_BITS;
+            for (usize i = 0; i < n; i++)
+            {
+                auto const &scalar = std::get<1>(pairs[i]);
+                if (limb < scalar.size() && ((scalar[limb] >> off) & 1))
+                {
+                    index |= usize(1) << i;
+                }
+            }
+
+            if (index != 0)
+            {
+                res.add(table[index], wc, context);
+            }
+        }
+
+        return res;
+    }
+
     template <class C>
     void add(CurvePoint<E> const &b, WeierstrassCurve<E> const &wc, C const &context)
     {
@@ -227,7 +519,7 @@ public:
             return;
         }
 
-        if (b.z == E::one(context))
+        if (b.state == PointState::Affine)
         {
             this->add_mixed(b, wc, context);
             return;
@@ -318,6 +610,7 @@ public:
             this->z.sub(z1z1);
             this->z.sub(z2z2);
             this->z.mul(h);
+            this->state = PointState::Jacobian;
         }
     }
 
@@ -335,7 +628,7 @@ public:
             return;
         }
 
-        if (b.z != E::one(context))
+        if (b.state != PointState::Affine)
         {
             this->add(b, wc, context);
             return;
@@ -411,6 +704,7 @@ public:
             this->z.square();
             this->z.sub(z1z1);
             this->z.sub(hh);
+            this->state = PointState::Jacobian;
         }
     }
 
@@ -422,8 +716,9 @@ private:
             return;
         }
         auto const one = x.one();
-        if (z == one)
+        if (state == PointState::Affine || z == one)
         {
+            state = PointState::Affine;
             return;
         }
 
@@ -439,6 +734,7 @@ private:
         y.mul(zinv_powered);
 
         z = one;
+        state = PointState::Affine;
     }
 
     void mul2_generic(WeierstrassCurve<E> const &wc)
@@ -572,6 +868,438 @@ private:
         c.mul2();
         this->y.sub(c);
     }
+
+    void mul2_a_is_minus_3()
+    {
+        if (this->is_zero())
+        {
+            return;
+        }
+
+        // http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
+
+        // delta = Z1^2
+        auto delta = this->z;
+        delta.square();
+
+        // gamma = Y1^2
+        auto gamma = this->y;
+        gamma.square();
+
+        // beta = X1*gamma
+        auto beta = this->x;
+        beta.mul(gamma);
+
+        // alpha = 3*(X1-delta)*(X1+delta)
+        auto alpha = this->x;
+        alpha.sub(delta);
+        auto t = this->x;
+        t.add(delta);
+        alpha.mul(t);
+        t = alpha;
+        alpha.mul2();
+        alpha.add(t);
+
+        // Z3 = (Y1+Z1)^2-gamma-delta
+        this->z.add(this->y);
+        this->z.square();
+        this->z.sub(gamma);
+        this->z.sub(delta);
+
+        // X3 = alpha^2-8*beta
+        beta.mul2();
+        beta.mul2();
+        this->x = alpha;
+        this->x.square();
+        this->x.sub(beta);
+        this->x.sub(beta);
+
+        // Y3 = alpha*(4*beta-X3)-8*gamma^2
+        this->y = beta;
+        this->y.sub(this->x);
+        this->y.mul(alpha);
+        gamma.square();
+        gamma.mul2();
+        gamma.mul2();
+        gamma.mul2();
+        this->y.sub(gamma);
+    }
+};
+
+// ****************************** COMPLETE PROJECTIVE ***************************** //
+// Homogeneous projective point (X/Z, Y/Z) added with the complete formulas of Renes, Costello and Batina,
+// https://eprint.iacr.org/2015/1060. On curves of odd order they hold for any two points, doubling and
+// the point at infinity (0 : 1 : 0) included, so an addition takes no data dependent branches.
+// E: Element
+template <class E>
+class ProjectivePoint
+{
+public:
+    E x;
+    E y;
+    E z;
+
+    ProjectivePoint(E x, E y, E z) : x(x), y(y), z(z) {}
+
+    // Jacobian (X : Y : Z) is projective (X*Z : Y : Z^3)
+    ProjectivePoint(CurvePoint<E> const &p) : x(p.x), y(p.y), z(p.z)
+    {
+        if (p.is_zero())
+        {
+            x = p.x.zero();
+            y = p.x.one();
+            return;
+        }
+
+        x.mul(p.z);
+        z.square();
+        z.mul(p.z);
+    }
+
+    // Projective (X : Y : Z) is Jacobian (X*Z : Y*Z^2 : Z)
+    CurvePoint<E> into_jacobian() const
+    {
+        auto z2 = z;
+        z2.square();
+        auto jx = x;
+        jx.mul(z);
+        auto jy = y;
+        jy.mul(z2);
+
+        return CurvePoint<E>(jx, jy, z);
+    }
+
+    bool is_zero() const
+    {
+        return z.is_zero();
+    }
+
+    void add(ProjectivePoint<E> const &b, WeierstrassCurve<E> const &wc)
+    {
+        switch (wc.ctype())
+        {
+        case CurveType::AIsZero:
+            this->add_a_is_zero(b, wc);
+            break;
+
+        case CurveType::AIsMinus3:
+            this->add_a_is_minus_3(b, wc);
+            break;
+
+        default:
+            this->add_generic(b, wc);
+        }
+    }
+
+    void mul2(WeierstrassCurve<E> const &wc)
+    {
+        auto const self = *this;
+        this->add(self, wc);
+    }
+
+    // Takes p if choice is set, with no branch on choice.
+    void conditional_assign(ProjectivePoint<E> const &p, bool choice)
+    {
+        x.conditional_assign(p.x, choice);
+        y.conditional_assign(p.y, choice);
+        z.conditional_assign(p.z, choice);
+    }
+
+    // Returnes multiple of this by a scalar, adding at every bit and keeping the sum only where it is set.
+    ProjectivePoint<E> mul(std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc) const
+    {
+        auto res = ProjectivePoint<E>(x.zero(), x.one(), x.zero());
+        for (auto it = RevBitIterator(scalar); it.before();)
+        {
+            res.mul2(wc);
+            auto sum = res;
+            sum.add(*this, wc);
+            res.conditional_assign(sum, *it);
+        }
+
+        return res;
+    }
+
+    // Sum of Jacobian points with the complete formulas, nothing if they fail, which only happens on
+    // curves of even order.
+    static Option<CurvePoint<E>> sum(CurvePoint<E> const &a, CurvePoint<E> const &b, WeierstrassCurve<E> const &wc)
+    {
+        auto r = ProjectivePoint<E>(a);
+        r.add(ProjectivePoint<E>(b), wc);
+        if (r.is_degenerate())
+        {
+            return {};
+        }
+
+        return r.into_jacobian();
+    }
+
+    // Multiple of a Jacobian point with the complete formulas, nothing if they fail as in sum.
+    static Option<CurvePoint<E>> product(CurvePoint<E> const &p, std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc)
+    {
+        auto const r = ProjectivePoint<E>(p).mul(scalar, wc);
+        if (r.is_degenerate())
+        {
+            return {};
+        }
+
+        return r.into_jacobian();
+    }
+
+    // (0 : 0 : 0) is what the formulas give for exceptional points, once reached it stays.
+    bool is_degenerate() const
+    {
+        return x.is_zero() && y.is_zero() && z.is_zero();
+    }
+
+private:
+    // 3*b
+    static E b3(WeierstrassCurve<E> const &wc)
+    {
+        auto b3 = wc.get_b();
+        b3.mul2();
+        b3.add(wc.get_b());
+
+        return b3;
+    }
+
+    // Algorithm 1 of the paper
+    void add_generic(ProjectivePoint<E> const &b, WeierstrassCurve<E> const &wc)
+    {
+        auto const &a = wc.get_a();
+        auto const b3 = ProjectivePoint<E>::b3(wc);
+
+        auto t0 = x;
+        t0.mul(b.x);
+        auto t1 = y;
+        t1.mul(b.y);
+        auto t2 = z;
+        t2.mul(b.z);
+
+        // t3 = (X1+Y1)*(X2+Y2)-t0-t1
+        auto t3 = x;
+        t3.add(y);
+        auto t4 = b.x;
+        t4.add(b.y);
+        t3.mul(t4);
+        t3.sub(t0);
+        t3.sub(t1);
+
+        // t4 = (X1+Z1)*(X2+Z2)-t0-t2
+        t4 = x;
+        t4.add(z);
+        auto t5 = b.x;
+        t5.add(b.z);
+        t4.mul(t5);
+        t4.sub(t0);
+        t4.sub(t2);
+
+        // t5 = (Y1+Z1)*(Y2+Z2)-t1-t2
+        t5 = y;
+        t5.add(z);
+        auto x3 = b.y;
+        x3.add(b.z);
+        t5.mul(x3);
+        t5.sub(t1);
+        t5.sub(t2);
+
+        // Z3 = a*t4+b3*t2, X3 = t1-Z3, Z3 = t1+Z3, Y3 = X3*Z3
+        auto z3 = t4;
+        z3.mul(a);
+        x3 = t2;
+        x3.mul(b3);
+        z3.add(x3);
+        x3 = t1;
+        x3.sub(z3);
+        z3.add(t1);
+        auto y3 = x3;
+        y3.mul(z3);
+
+        // t1 = 3*t0+a*t2, t4 = b3*t4+a*(t0-a*t2)
+        t1 = t0;
+        t1.mul2();
+        t1.add(t0);
+        t2.mul(a);
+        t4.mul(b3);
+        t1.add(t2);
+        t2.negate();
+        t2.add(t0);
+        t2.mul(a);
+        t4.add(t2);
+
+        // Y3 = Y3+t1*t4, X3 = t3*X3-t5*t4, Z3 = t5*Z3+t3*t1
+        t0 = t1;
+        t0.mul(t4);
+        y3.add(t0);
+        t0 = t5;
+        t0.mul(t4);
+        x3.mul(t3);
+        x3.sub(t0);
+        t0 = t3;
+        t0.mul(t1);
+        z3.mul(t5);
+        z3.add(t0);
+
+        x = x3;
+        y = y3;
+        z = z3;
+    }
+
+    // Algorithm 4 of the paper
+    void add_a_is_minus_3(ProjectivePoint<E> const &b, WeierstrassCurve<E> const &wc)
+    {
+        auto const &curve_b = wc.get_b();
+
+        auto t0 = x;
+        t0.mul(b.x);
+        auto t1 = y;
+        t1.mul(b.y);
+        auto t2 = z;
+        t2.mul(b.z);
+
+        // t3 = (X1+Y1)*(X2+Y2)-t0-t1
+        auto t3 = x;
+        t3.add(y);
+        auto t4 = b.x;
+        t4.add(b.y);
+        t3.mul(t4);
+        t3.sub(t0);
+        t3.sub(t1);
+
+        // t4 = (Y1+Z1)*(Y2+Z2)-t1-t2
+        t4 = y;
+        t4.add(z);
+        auto x3 = b.y;
+        x3.add(b.z);
+        t4.mul(x3);
+        t4.sub(t1);
+        t4.sub(t2);
+
+        // Y3 = (X1+Z1)*(X2+Z2)-t0-t2
+        x3 = x;
+        x3.add(z);
+        auto y3 = b.x;
+        y3.add(b.z);
+        y3.mul(x3);
+        y3.sub(t0);
+        y3.sub(t2);
+
+        // X3 = 3*(Y3-b*t2), Z3 = t1-X3, X3 = t1+X3
+        auto z3 = t2;
+        z3.mul(curve_b);
+        x3 = y3;
+        x3.sub(z3);
+        z3 = x3;
+        z3.mul2();
+        x3.add(z3);
+        z3 = t1;
+        z3.sub(x3);
+        x3.add(t1);
+
+        // Y3 = 3*(b*Y3-3*t2-t0)
+        y3.mul(curve_b);
+        t1 = t2;
+        t1.mul2();
+        t2.add(t1);
+        y3.sub(t2);
+        y3.sub(t0);
+        t1 = y3;
+        t1.mul2();
+        y3.add(t1);
+
+        // t0 = 3*t0-3*t2
+        t1 = t0;
+        t1.mul2();
+        t0.add(t1);
+        t0.sub(t2);
+
+        // Y3 = X3*Z3+t0*Y3, X3 = t3*X3-t4*Y3, Z3 = t4*Z3+t3*t0
+        t1 = t4;
+        t1.mul(y3);
+        t2 = t0;
+        t2.mul(y3);
+        y3 = x3;
+        y3.mul(z3);
+        y3.add(t2);
+        x3.mul(t3);
+        x3.sub(t1);
+        z3.mul(t4);
+        t1 = t3;
+        t1.mul(t0);
+        z3.add(t1);
+
+        x = x3;
+        y = y3;
+        z = z3;
+    }
+
+    // Algorithm 7 of the paper
+    void add_a_is_zero(ProjectivePoint<E> const &b, WeierstrassCurve<E> const &wc)
+    {
+        auto const b3 = ProjectivePoint<E>::b3(wc);
+
+        auto t0 = x;
+        t0.mul(b.x);
+        auto t1 = y;
+        t1.mul(b.y);
+        auto t2 = z;
+        t2.mul(b.z);
+
+        // t3 = (X1+Y1)*(X2+Y2)-t0-t1
+        auto t3 = x;
+        t3.add(y);
+        auto t4 = b.x;
+        t4.add(b.y);
+        t3.mul(t4);
+        t3.sub(t0);
+        t3.sub(t1);
+
+        // t4 = (Y1+Z1)*(Y2+Z2)-t1-t2
+        t4 = y;
+        t4.add(z);
+        auto x3 = b.y;
+        x3.add(b.z);
+        t4.mul(x3);
+        t4.sub(t1);
+        t4.sub(t2);
+
+        // Y3 = (X1+Z1)*(X2+Z2)-t0-t2
+        x3 = x;
+        x3.add(z);
+        auto y3 = b.x;
+        y3.add(b.z);
+        y3.mul(x3);
+        y3.sub(t0);
+        y3.sub(t2);
+
+        // t0 = 3*t0, t2 = b3*t2, Z3 = t1+t2, t1 = t1-t2, Y3 = b3*Y3
+        x3 = t0;
+        x3.mul2();
+        t0.add(x3);
+        t2.mul(b3);
+        auto z3 = t1;
+        z3.add(t2);
+        t1.sub(t2);
+        y3.mul(b3);
+
+        // X3 = t3*t1-t4*Y3, Y3 = t1*Z3+Y3*t0, Z3 = Z3*t4+t0*t3
+        x3 = t4;
+        x3.mul(y3);
+        t2 = t3;
+        t2.mul(t1);
+        t2.sub(x3);
+        x3 = t2;
+        y3.mul(t0);
+        t1.mul(z3);
+        y3.add(t1);
+        t0.mul(t3);
+        z3.mul(t4);
+        z3.add(t0);
+
+        x = x3;
+        y = y3;
+        z = z3;
+    }
 };
 
 #endif
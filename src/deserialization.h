@@ -2,9 +2,12 @@
 #define H_DESERIALIZATION
 
 #include "common.h"
+#include "constants.h"
 #include "repr.h"
 #include "field.h"
 #include "curve.h"
+#include "multiexp.h"
+#include "table_cache.h"
 #include "extension_towers/fp2.h"
 #include "extension_towers/fp3.h"
 
@@ -12,11 +15,14 @@
 
 class Deserializer
 {
+    std::vector<uint8_t>::const_iterator const start;
     std::vector<uint8_t>::const_iterator begin;
     std::vector<uint8_t>::const_iterator const end;
+    bool compressed_points_;
+    bool complete_formulas_;
 
 public:
-    Deserializer(std::vector<std::uint8_t> const &input) : begin(input.cbegin()), end(input.cend()) {}
+    Deserializer(std::vector<std::uint8_t> const &input) : start(input.cbegin()), begin(input.cbegin()), end(input.cend()), compressed_points_(false), complete_formulas_(false) {}
 
     // Consumes a byte, throws error otherwise
     u8
@@ -75,6 +81,40 @@ public:
         return end - begin;
     }
 
+    // Number of bytes consumed so far
+    usize position() const
+    {
+        return begin - start;
+    }
+
+    // Bytes consumed since position from
+    std::string consumed(usize from = 0) const
+    {
+        return std::string(start + from, begin);
+    }
+
+    // Whether points are encoded by x and the sign of y
+    bool compressed_points() const
+    {
+        return compressed_points_;
+    }
+
+    void set_compressed_points(bool compressed_points)
+    {
+        compressed_points_ = compressed_points;
+    }
+
+    // Whether point operations use the complete formulas
+    bool complete_formulas() const
+    {
+        return complete_formulas_;
+    }
+
+    void set_complete_formulas(bool complete_formulas)
+    {
+        complete_formulas_ = complete_formulas;
+    }
+
 private:
     // Deserializes number in Big endian format with bytes.
     template <class T>
@@ -91,6 +131,16 @@ private:
     }
 };
 
+// Operation without flags of opt-in encodings, which are set on deserializer
+u8 deserialize_operation(Deserializer &deserializer)
+{
+    auto const operation = deserializer.byte("Input should be longer than operation type encoding");
+    deserializer.set_compressed_points(operation & OPERATION_COMPRESSED_POINTS);
+    deserializer.set_complete_formulas(operation & OPERATION_COMPLETE_FORMULAS);
+
+    return operation & ~(OPERATION_COMPRESSED_POINTS | OPERATION_COMPLETE_FORMULAS);
+}
+
 // True if minus
 bool deserialize_sign(Deserializer &deserializer)
 {
@@ -265,9 +315,60 @@ WeierstrassCurve<F> deserialize_weierstrass_curve(u8 mod_byte_len, C const &fiel
     return WeierstrassCurve(a, b, order, order_len);
 }
 
+// Bytes of a point with coordinates in an extension of degree.
+u32 curve_point_length(u8 mod_byte_len, u8 extension_degree, Deserializer const &deserializer)
+{
+    if (deserializer.compressed_points())
+    {
+        return COMPRESSED_POINT_SIGN_LENGTH + extension_degree * mod_byte_len;
+    }
+
+    return 2 * extension_degree * mod_byte_len;
+}
+
+// Recovers y as the root of x^3 + a*x + b with the encoded sign.
+template <class F, class C>
+CurvePoint<F> deserialize_compressed_curve_point(u8 mod_byte_len, C const &field, WeierstrassCurve<F> const &wc, Deserializer &deserializer)
+{
+    auto const sign = deserializer.byte("Input is not long enough to get point sign");
+    if (sign != COMPRESSED_POINT_SIGN_PLUS && sign != COMPRESSED_POINT_SIGN_MINUS)
+    {
+        input_err("Point sign is not encoded properly");
+    }
+
+    F x = deserialize_fpM(mod_byte_len, field, deserializer);
+    auto rhs = x;
+    rhs.square();
+    rhs.add(wc.get_a());
+    rhs.mul(x);
+    rhs.add(wc.get_b());
+    auto const root = rhs.sqrt();
+    if (!root)
+    {
+        input_err("Point is not on curve");
+    }
+
+    auto y = root.value();
+    if (y.sign() != (sign == COMPRESSED_POINT_SIGN_MINUS))
+    {
+        if (y.is_zero())
+        {
+            input_err("Point sign is not encoded properly");
+        }
+        y.negate();
+    }
+
+    return CurvePoint(x, y);
+}
+
 template <class F, class C>
 CurvePoint<F> deserialize_curve_point(u8 mod_byte_len, C const &field, WeierstrassCurve<F> const &wc, Deserializer &deserializer)
 {
+    if (deserializer.compressed_points())
+    {
+        return deserialize_compressed_curve_point<F>(mod_byte_len, field, wc, deserializer);
+    }
+
     F x = deserialize_fpM(mod_byte_len, field, deserializer);
     F y = deserialize_fpM(mod_byte_len, field, deserializer);
     auto const cp = CurvePoint(x, y);
@@ -281,9 +382,14 @@ CurvePoint<F> deserialize_curve_point(u8 mod_byte_len, C const &field, Weierstra
 }
 
 // ********************** POINTS deserialization ******************************* //
+
+// Keys of G2 points hold the input bytes of the curves and the point. G2 points that were prepared
+// for a pairing before are in the cache under their key and skip the subgroup check.
 template <usize N, class F, class C>
-std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F>>> deserialize_points(u8 mod_byte_len, C const &field, WeierstrassCurve<Fp<N>> const &g1_curve, WeierstrassCurve<F> const &g2_curve, Deserializer &deserializer)
+std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F>>> deserialize_points(u8 mod_byte_len, C const &field, WeierstrassCurve<Fp<N>> const &g1_curve, WeierstrassCurve<F> const &g2_curve, Deserializer &deserializer, std::vector<std::string> &g2_keys)
 {
+    auto const curves_key = deserializer.consumed();
+
     // deser (CurvePoint<Fp<N>>,CurvePoint<F>) pairs
     auto const num_pairs = deserializer.byte("Input is not long enough to get number of pairs");
     if (num_pairs == 0)
@@ -291,18 +397,32 @@ std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F>>> deserialize_points(u8
         input_err("Zero pairs encoded");
     }
 
-    std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F>>> points;
+    std::vector<CurvePoint<Fp<N>>> g1_points;
+    std::vector<CurvePoint<F>> g2_points;
+    std::vector<CurvePoint<F>> g2_unchecked;
     for (auto i = 0; i < num_pairs; i++)
     {
-        auto const g1 = deserialize_curve_point<Fp<N>, PrimeField<N>>(mod_byte_len, field, g1_curve, deserializer);
-        auto const g2 = deserialize_curve_point<F>(mod_byte_len, field, g2_curve, deserializer);
+        g1_points.push_back(deserialize_curve_point<Fp<N>, PrimeField<N>>(mod_byte_len, field, g1_curve, deserializer));
 
-        if (!g1.check_correct_subgroup(g1_curve, field) || !g2.check_correct_subgroup(g2_curve, field))
+        auto const point_start = deserializer.position();
+        g2_points.push_back(deserialize_curve_point<F>(mod_byte_len, field, g2_curve, deserializer));
+        g2_keys.push_back(curves_key + deserializer.consumed(point_start));
+        if (!TableCache::prepared_g2().get(g2_keys.back()))
         {
-            input_err("G1 or G2 point is not in the expected subgroup");
+            g2_unchecked.push_back(g2_points.back());
         }
+    }
+
+    // All points at once so that many of them can share a check
+    if (!check_correct_subgroup(g1_points, g1_curve, field) || !check_correct_subgroup(g2_unchecked, g2_curve, field))
+    {
+        input_err("G1 or G2 point is not in the expected subgroup");
+    }
 
-        points.push_back(std::tuple(g1, g2));
+    std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F>>> points;
+    for (auto i = 0; i < num_pairs; i++)
+    {
+        points.push_back(std::tuple(g1_points[i], g2_points[i]));
     }
 
     return points;
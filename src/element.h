@@ -95,6 +95,151 @@ public:
 
         return l != e_one;
     }
+
+    // Square root in a field of q elements, nothing if this is not a square.
+    // Uses this^((q+1)/4) for q = 3 mod 4, Atkin's formula for q = 5 mod 8 and Tonelli-Shanks otherwise.
+    template <usize N>
+    Option<E> sqrt_with(Repr<N> const &q) const
+    {
+        if (is_zero())
+        {
+            return self();
+        }
+
+        constexpr Repr<N> one = {1};
+        auto root = self();
+        if (q[0] % 4 == 3)
+        {
+            root = this->pow(cbn::add_ignore_carry(cbn::shift_right(q, 2), one));
+        }
+        else if (q[0] % 8 == 5)
+        {
+            // b = (2a)^((q-5)/8), i = 2a*b^2, root = a*b*(i-1)
+            auto two_a = self();
+            two_a.mul2();
+            auto const b = two_a.pow(cbn::shift_right(q, 3));
+            auto i = b;
+            i.square();
+            i.mul(two_a);
+            i.sub(this->one());
+            root.mul(b);
+            root.mul(i);
+        }
+        else
+        {
+            root = tonelli_shanks(q);
+        }
+
+        auto check = root;
+        check.square();
+        if (check != self())
+        {
+            return {};
+        }
+
+        return root;
+    }
+
+private:
+    // Root of this if it is a square, something else otherwise.
+    template <usize N>
+    E tonelli_shanks(Repr<N> const &q) const
+    {
+        // q - 1 = 2^s * t with t odd
+        constexpr Repr<N> one = {1};
+        auto t = cbn::subtract_ignore_carry(q, one);
+        u32 s = 0;
+        while (t[0] % 2 == 0)
+        {
+            t = cbn::shift_right(t, 1);
+            s++;
+        }
+
+        // Small integers that are non squares in the prime field stay so in its odd degree extensions
+        auto const e_one = this->one();
+        auto z = e_one;
+        do
+        {
+            z.add(e_one);
+        } while (!z.is_non_nth_root_with(2, q));
+
+        // w = a^((t-1)/2), x = a^((t+1)/2), b = a^t
+        auto const w = this->pow(cbn::shift_right(t, 1));
+        auto x = self();
+        x.mul(w);
+        auto b = x;
+        b.mul(w);
+        auto c = z.pow(t);
+
+        auto m = s;
+        while (b != e_one)
+        {
+            // Least i with b^(2^i) = 1
+            u32 i = 0;
+            for (auto b2 = b; b2 != e_one; i++)
+            {
+                if (i + 1 == m)
+                {
+                    return x;
+                }
+                b2.square();
+            }
+
+            auto g = c;
+            for (u32 k = 0; k + i + 1 < m; k++)
+            {
+                g.square();
+            }
+            x.mul(g);
+            c = g;
+            c.square();
+            b.mul(c);
+            m = i;
+        }
+
+        return x;
+    }
 };
 
+// Inverts all elements with a single inversion (Montgomery's trick).
+// Returns false and leaves elements untouched if any of them is zero.
+template <class E>
+bool batch_inverse(std::vector<E> &elements)
+{
+    if (elements.empty())
+    {
+        return true;
+    }
+
+    // products[i] = elements[0] * ... * elements[i]
+    std::vector<E> products;
+    products.reserve(elements.size());
+    products.push_back(elements[0]);
+    for (usize i = 1; i < elements.size(); i++)
+    {
+        auto product = products.back();
+        product.mul(elements[i]);
+        products.push_back(product);
+    }
+
+    auto const oinv = products.back().inverse();
+    if (!oinv)
+    {
+        return false;
+    }
+    auto inv = oinv.value();
+
+    for (usize i = elements.size() - 1; i > 0; i--)
+    {
+        // inv is the inverse of products[i]
+        auto element_inv = inv;
+        element_inv.mul(products[i - 1]);
+        inv.mul(elements[i]);
+        elements[i] = element_inv;
+    }
+    elements[0] = inv;
+
+    return true;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,511 @@
+#ifndef H_ENDOMORPHISM
+#define H_ENDOMORPHISM
+
+#include "common.h"
+#include "repr.h"
+#include "curve.h"
+#include "extension_towers/fp2.h"
+
+// ****************************** PSI ***************************** //
+
+// (x, y) -> (cx * x^p, cy * y^p) maps the curve to itself iff
+// cy^2 = cx^3, cy^2 * a^p = cx * a and cy^2 * b^p = b.
+template <usize N>
+bool is_psi_endomorphism(Fp2<N> const &cx, Fp2<N> const &cy, WeierstrassCurve<Fp2<N>> const &wc)
+{
+    auto cy2 = cy;
+    cy2.square();
+
+    auto cx3 = cx;
+    cx3.square();
+    cx3.mul(cx);
+    if (cy2 != cx3)
+    {
+        return false;
+    }
+
+    auto ap = wc.get_a();
+    ap.frobenius_map(1);
+    ap.mul(cy2);
+    auto a_cx = wc.get_a();
+    a_cx.mul(cx);
+    if (ap != a_cx)
+    {
+        return false;
+    }
+
+    auto bp = wc.get_b();
+    bp.frobenius_map(1);
+    bp.mul(cy2);
+
+    return bp == wc.get_b();
+}
+
+// Jacobian coordinates: (X : Y : Z) -> (cx * X^p : cy * Y^p : Z^p)
+template <usize N>
+void apply_psi(CurvePoint<Fp2<N>> &point, Fp2<N> const &cx, Fp2<N> const &cy)
+{
+    point.x.frobenius_map(1);
+    point.x.mul(cx);
+    point.y.frobenius_map(1);
+    point.y.mul(cy);
+    // Z^p is zero or one if Z was, so the state of the point holds
+    point.z.frobenius_map(1);
+}
+
+// Coefficients of psi on the sextic twist of y^2 = x^3 + b defined by non residue and twist type:
+// cx = non_residue^((p-1)/3), cy = non_residue^((p-1)/2) for D and their inverses for M.
+// Returns nothing unless non residue is neither a square nor a cube, as the twist is then not sextic.
+template <usize N>
+Option<std::tuple<Fp2<N>, Fp2<N>>> psi_coefficients(Fp2<N> const &non_residue, TwistType twist_type, WeierstrassCurve<Fp2<N>> const &wc)
+{
+    // Non residue is a square (cube) in Fp2 iff its norm is a square (cube) in Fp
+    auto norm = non_residue.c1;
+    norm.square();
+    non_residue.field.mul_by_nonresidue(norm);
+    norm.negate();
+    auto c0_2 = non_residue.c0;
+    c0_2.square();
+    norm.add(c0_2);
+    if (!norm.is_non_nth_root(2) || !norm.is_non_nth_root(3))
+    {
+        return {};
+    }
+
+    constexpr Repr<N> one = {1};
+    constexpr Repr<N> two = {2};
+    constexpr Repr<N> three = {3};
+    auto const p_minus_one = non_residue.field.mod() - one;
+    auto cx = non_residue.pow(p_minus_one / three);
+    auto cy = non_residue.pow(p_minus_one / two);
+    if (twist_type == M)
+    {
+        auto const ocx_inv = cx.inverse();
+        auto const ocy_inv = cy.inverse();
+        if (!ocx_inv || !ocy_inv)
+        {
+            return {};
+        }
+        cx = ocx_inv.value();
+        cy = ocy_inv.value();
+    }
+
+    if (!is_psi_endomorphism(cx, cy, wc))
+    {
+        return {};
+    }
+
+    return std::tuple(cx, cy);
+}
+
+// Untwist-Frobenius-twist endomorphism psi(x, y) = (cx * x^p, cy * y^p) on curves over Fp2 (GLS).
+// On G2 of BN and BLS12 twists it acts as multiplication by p mod r.
+template <usize N>
+class PsiEndomorphism : public Endomorphism<Fp2<N>>
+{
+    FieldExtension2<N> const &field;
+
+public:
+    PsiEndomorphism(std::vector<u64> m, u32 dimension, FieldExtension2<N> const &field) : Endomorphism<Fp2<N>>(m, dimension), field(field) {}
+
+    Option<std::vector<CurvePoint<Fp2<N>>>> orbit(CurvePoint<Fp2<N>> const &p, WeierstrassCurve<Fp2<N>> const &wc) const
+    {
+        if (p.is_zero())
+        {
+            return {};
+        }
+
+        // q = [m]p is the image of p if p is in the eigenspace. Instead of trusting the twist
+        // we solve psi(p) = q for coefficients and check that they give an endomorphism of the curve.
+        auto const q = p.mul_generic(this->m, wc, field);
+        if (q.is_zero())
+        {
+            return {};
+        }
+
+        auto xp = p.x;
+        xp.frobenius_map(1);
+        auto yp = p.y;
+        yp.frobenius_map(1);
+        auto zp = p.z;
+        zp.frobenius_map(1);
+
+        // cx = (q.x / q.z^2) / (xp / zp^2), cy = (q.y / q.z^3) / (yp / zp^3) with one inversion
+        auto zp2 = zp;
+        zp2.square();
+        auto zp3 = zp2;
+        zp3.mul(zp);
+        auto qz2 = q.z;
+        qz2.square();
+        auto qz3 = qz2;
+        qz3.mul(q.z);
+
+        auto denominator = qz3;
+        denominator.mul(xp);
+        denominator.mul(yp);
+        auto const odenominator_inv = denominator.inverse();
+        if (!odenominator_inv)
+        {
+            return {};
+        }
+        auto const denominator_inv = odenominator_inv.value();
+
+        auto cx = q.x;
+        cx.mul(q.z);
+        cx.mul(zp2);
+        cx.mul(yp);
+        cx.mul(denominator_inv);
+
+        auto cy = q.y;
+        cy.mul(zp3);
+        cy.mul(xp);
+        cy.mul(denominator_inv);
+
+        if (!is_psi_endomorphism(cx, cy, wc))
+        {
+            return {};
+        }
+
+        std::vector<CurvePoint<Fp2<N>>> points;
+        points.push_back(p);
+        points.push_back(q);
+        for (u32 i = 2; i < this->dimension; i++)
+        {
+            auto next = points.back();
+            apply_psi(next, cx, cy);
+            points.push_back(next);
+        }
+
+        return points;
+    }
+
+};
+
+// ********************* OVERLOADED endomorphism detection *********************** //
+
+// No endomorphism is known for generic curves.
+template <class E, class C>
+void detect_endomorphism(WeierstrassCurve<E> &wc, C const &context)
+{
+    UNUSED(wc);
+    UNUSED(context);
+}
+
+// Curves over Fp2 whose group order r makes m = +-(p mod r) a small root of r qualify for psi.
+template <usize N>
+void detect_endomorphism(WeierstrassCurve<Fp2<N>> &wc, FieldExtension2<N> const &field)
+{
+    auto const &order = wc.subgroup_order();
+    if (num_bits(order) <= 1)
+    {
+        return;
+    }
+
+    auto const modulus = field.mod();
+    std::vector<u64> m(modulus.cbegin(), modulus.cend());
+    div_rem(m, order);
+
+    // m = min(p mod r, r - (p mod r))
+    auto neg_m = order;
+    neg_m.resize(max(neg_m.size(), m.size()), 0);
+    sub_noborrow(neg_m, m);
+    if (greater_or_equal(m, neg_m))
+    {
+        m = neg_m;
+    }
+    if (num_bits(m) <= 1)
+    {
+        return;
+    }
+
+    // Smallest dimension such that m^dimension >= r
+    u32 dimension = 1;
+    auto m_power = m;
+    while (!greater_or_equal(m_power, order) && dimension <= 4)
+    {
+        m_power = multiply(m_power, m);
+        dimension++;
+    }
+
+    // Checking that a point is in the eigenspace costs a multiplication by m, so digits
+    // must be much shorter than r: BLS12 (m ~ r^(1/4)) qualifies, BN (m ~ r^(1/2)) doesn't.
+    if (dimension != 4)
+    {
+        return;
+    }
+
+    wc.set_endomorphism(std::make_shared<PsiEndomorphism<N> const>(m, dimension, field));
+}
+
+// ****************************** SUBGROUP TESTS ***************************** //
+
+// Whether #E(Fp) = cofactor * r, checked on the first point with a small x that the cofactor
+// doesn't kill. Such a point has order divisible by r, and the Hasse interval, shorter than r,
+// holds a single multiple of r. This fixes the trace of the curve, so it's the one of its family.
+template <usize N>
+bool has_group_order(WeierstrassCurve<Fp<N>> const &wc, std::vector<u64> const &cofactor, PrimeField<N> const &field)
+{
+    // r > 4 * sqrt(p)
+    auto const p_repr = field.mod();
+    std::vector<u64> const modulus(p_repr.cbegin(), p_repr.cend());
+    if (2 * num_bits(wc.subgroup_order()) < num_bits(modulus) + 6)
+    {
+        return false;
+    }
+
+    for (u64 x_value = 0; x_value < 256; x_value++)
+    {
+        Repr<N> const x_repr = {x_value};
+        auto const x = Fp<N>::from_repr(x_repr, field);
+        auto rhs = x;
+        rhs.square();
+        rhs.add(wc.get_a());
+        rhs.mul(x);
+        rhs.add(wc.get_b());
+        auto const root = rhs.sqrt();
+        if (!root)
+        {
+            continue;
+        }
+
+        auto const p = CurvePoint<Fp<N>>(x, root.value()).mul_generic(cofactor, wc, field);
+        if (!p.is_zero())
+        {
+            return p.mul_generic(wc.subgroup_order(), wc, field).is_zero();
+        }
+    }
+
+    return false;
+}
+
+// Scott's test for G1 of BLS12: with phi(x, y) = (beta * x, y) a point is in G1 iff phi(P) = [-u^2]P.
+// phi - [-u^2] has degree u^4 - u^2 + 1 = r for both cube roots of unity beta, so either one is accepted.
+template <usize N>
+class GlvSubgroupTest : public SubgroupTest<Fp<N>>
+{
+    PrimeField<N> const &field;
+    Fp<N> beta;
+    std::vector<u64> u_2;
+
+public:
+    GlvSubgroupTest(PrimeField<N> const &field, Fp<N> beta, std::vector<u64> u_2) : field(field), beta(beta), u_2(u_2) {}
+
+    bool is_in_subgroup(CurvePoint<Fp<N>> const &p, WeierstrassCurve<Fp<N>> const &wc) const
+    {
+        if (p.is_zero())
+        {
+            return true;
+        }
+
+        auto q = p.mul_generic(u_2, wc, field);
+        q.negate();
+
+        auto phi_p = p;
+        phi_p.x.mul(beta);
+        auto in_subgroup = phi_p == q;
+        if (!in_subgroup)
+        {
+            phi_p.x.mul(beta);
+            in_subgroup = phi_p == q;
+        }
+
+        return in_subgroup;
+    }
+};
+
+// G1 of BN curves is the whole E(Fp) once its order is known to be r.
+template <usize N>
+class PrimeOrderSubgroupTest : public SubgroupTest<Fp<N>>
+{
+public:
+    bool is_in_subgroup(CurvePoint<Fp<N>> const &, WeierstrassCurve<Fp<N>> const &) const
+    {
+        return true;
+    }
+};
+
+// Scott's test for G2 of BN and BLS12: a point is in G2 iff psi(Q) = [lambda]Q for lambda = p mod r.
+// Only installed once the order of E(Fp) is known, as the order of the twist follows from its trace.
+template <usize N>
+class PsiSubgroupTest : public SubgroupTest<Fp2<N>>
+{
+    FieldExtension2<N> const &field;
+    Fp2<N> cx;
+    Fp2<N> cy;
+    std::vector<u64> lambda;
+    bool lambda_is_negative;
+
+public:
+    PsiSubgroupTest(FieldExtension2<N> const &field, Fp2<N> cx, Fp2<N> cy, std::vector<u64> lambda, bool lambda_is_negative) : field(field), cx(cx), cy(cy), lambda(lambda), lambda_is_negative(lambda_is_negative) {}
+
+    bool is_in_subgroup(CurvePoint<Fp2<N>> const &p, WeierstrassCurve<Fp2<N>> const &wc) const
+    {
+        if (p.is_zero())
+        {
+            return true;
+        }
+
+        auto q = p.mul_generic(lambda, wc, field);
+        if (lambda_is_negative)
+        {
+            q.negate();
+        }
+
+        auto psi_p = p;
+        apply_psi(psi_p, cx, cy);
+
+        return psi_p == q;
+    }
+};
+
+// Nontrivial cube root of unity in Fp, or nothing if p != 1 mod 3.
+template <usize N>
+Option<Fp<N>> cube_root_of_unity(PrimeField<N> const &field)
+{
+    constexpr Repr<N> one = {1};
+    constexpr Repr<N> three = {3};
+    auto const p_minus_one = field.mod() - one;
+    if (!cbn::is_zero(p_minus_one % three))
+    {
+        return {};
+    }
+
+    auto const e_one = Fp<N>::one(field);
+    for (u64 g = 2; g < 256; g++)
+    {
+        Repr<N> const g_repr = {g};
+        auto const beta = Fp<N>::from_repr(g_repr, field).pow(p_minus_one / three);
+        if (beta != e_one)
+        {
+            return beta;
+        }
+    }
+
+    return {};
+}
+
+// Installs subgroup tests on curves of the BLS12 family with parameter u:
+// r = u^4 - u^2 + 1 and 3p = (u - 1)^2 * r + 3u. Curves not in the family keep the generic test.
+template <usize N>
+void set_bls12_subgroup_tests(std::vector<u64> const &u, bool u_is_negative, TwistType twist_type, WeierstrassCurve<Fp<N>> &g1_curve, WeierstrassCurve<Fp2<N>> &g2_curve, FieldExtension2<N> const &field, Fp2<N> const &non_residue)
+{
+    auto const &order = g1_curve.subgroup_order();
+    auto const p_repr = field.mod();
+    std::vector<u64> const modulus(p_repr.cbegin(), p_repr.cend());
+
+    // r = u^4 - u^2 + 1
+    auto const u_2 = multiply(u, u);
+    auto r = multiply(u_2, u_2);
+    add_scalar(r, 1);
+    sub_noborrow(r, u_2);
+    if (!equal(r, order) || 2 * num_bits(r) < num_bits(modulus) + 3)
+    {
+        return;
+    }
+
+    // 3p = (u - 1)^2 * r + 3u, that is 3p = (|u| - 1)^2 * r + 3|u| or 3p + 3|u| = (|u| + 1)^2 * r
+    auto u_1 = u;
+    if (u_is_negative)
+    {
+        add_scalar(u_1, 1);
+    }
+    else
+    {
+        sub_noborrow(u_1, {1});
+    }
+    auto rhs = multiply(multiply(u_1, u_1), r);
+    auto lhs = modulus;
+    mul_scalar(lhs, 3);
+    auto three_u = u;
+    mul_scalar(three_u, 3);
+    add_nocarry(u_is_negative ? lhs : rhs, three_u);
+    if (!equal(lhs, rhs))
+    {
+        return;
+    }
+
+    auto const obeta = cube_root_of_unity(field);
+    auto const ocoeffs = psi_coefficients(non_residue, twist_type, g2_curve);
+    if (!obeta || !ocoeffs)
+    {
+        return;
+    }
+    auto const [cx, cy] = ocoeffs.value();
+
+    // G1 cofactor (u - 1)^2 / 3
+    auto u_1_2 = multiply(u_1, u_1);
+    auto const cofactor = div_rem(u_1_2, {3});
+    if (!has_group_order(g1_curve, cofactor, field))
+    {
+        return;
+    }
+
+    // On the sextic twist psi - [u] only kills points of order dividing (u - 1)^2 / 3 * r,
+    // and G2 cofactor is coprime to (u - 1)^2 / 3 for the whole family.
+    g1_curve.set_subgroup_test(std::make_shared<GlvSubgroupTest<N> const>(field, obeta.value(), u_2));
+    g2_curve.set_subgroup_test(std::make_shared<PsiSubgroupTest<N> const>(field, cx, cy, u, u_is_negative));
+}
+
+// Installs subgroup tests on curves of the BN family with parameter u:
+// r = 36u^4 + 36u^3 + 18u^2 + 6u + 1 and p = r + 6u^2. Curves not in the family keep the generic test.
+template <usize N>
+void set_bn_subgroup_tests(std::vector<u64> const &u, bool u_is_negative, TwistType twist_type, WeierstrassCurve<Fp<N>> &g1_curve, WeierstrassCurve<Fp2<N>> &g2_curve, FieldExtension2<N> const &field, Fp2<N> const &non_residue)
+{
+    auto const &order = g1_curve.subgroup_order();
+    auto const p_repr = field.mod();
+    std::vector<u64> const modulus(p_repr.cbegin(), p_repr.cend());
+
+    // Even powers and odd powers of u
+    auto const u_2 = multiply(u, u);
+    auto r = multiply(u_2, u_2);
+    mul_scalar(r, 36);
+    auto r_18 = u_2;
+    mul_scalar(r_18, 18);
+    add_nocarry(r, r_18);
+    add_scalar(r, 1);
+
+    auto odd = multiply(u_2, u);
+    mul_scalar(odd, 36);
+    auto r_6 = u;
+    mul_scalar(r_6, 6);
+    add_nocarry(odd, r_6);
+    if (u_is_negative)
+    {
+        if (!greater_or_equal(r, odd))
+        {
+            return;
+        }
+        sub_noborrow(r, odd);
+    }
+    else
+    {
+        add_nocarry(r, odd);
+    }
+
+    // lambda = p mod r = 6u^2
+    auto lambda = u_2;
+    mul_scalar(lambda, 6);
+    auto p = r;
+    add_nocarry(p, lambda);
+    if (!equal(r, order) || !equal(p, modulus))
+    {
+        return;
+    }
+
+    auto const ocoeffs = psi_coefficients(non_residue, twist_type, g2_curve);
+    if (!ocoeffs)
+    {
+        return;
+    }
+    auto const [cx, cy] = ocoeffs.value();
+    if (!has_group_order(g1_curve, {1}, field))
+    {
+        return;
+    }
+
+    // psi - [6u^2] has degree 36u^4 - (6u^2 + 1) * 6u^2 + p = r, so it only kills G2
+    g1_curve.set_subgroup_test(std::make_shared<PrimeOrderSubgroupTest<N> const>());
+    g2_curve.set_subgroup_test(std::make_shared<PsiSubgroupTest<N> const>(field, cx, cy, lambda, false));
+}
+
+#endif
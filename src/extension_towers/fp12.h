@@ -202,27 +202,243 @@ public:
         this->c1.c2 = g5;
     }
 
-    Fp12<N> cyclotomic_exp(std::vector<u64> const &exp) const
+    // Karabina's squaring of a compressed element of the cyclotomic subgroup, which keeps only
+    // g1 = c0.c1, g2 = c0.c2, g3 = c1.c0 and g5 = c1.c2; g0 = c0.c0 and g4 = c1.c1 are left stale
+    // until batch_decompress.
+    void compressed_cyclotomic_square()
     {
-        auto res = one();
+        FieldExtension3over2<N> const &field_2 = this->field;
+
+        auto const g1 = this->c0.c1;
+        auto const g2 = this->c0.c2;
+        auto const g3 = this->c1.c0;
+        auto const g5 = this->c1.c2;
+
+        auto g1_2 = g1;
+        g1_2.square();
+        auto g2_2 = g2;
+        g2_2.square();
+        auto g3_2 = g3;
+        g3_2.square();
+        auto g5_2 = g5;
+        g5_2.square();
+
+        // t0 = 2 * g1 * g5
+        auto t0 = g1;
+        t0.add(g5);
+        t0.square();
+        t0.sub(g1_2);
+        t0.sub(g5_2);
+
+        // t1 = 2 * g3 * g2
+        auto t1 = g3;
+        t1.add(g2);
+        t1.square();
+        t1.sub(g3_2);
+        t1.sub(g2_2);
+
+        // g3' = 3 * xi * t0 + 2 * g3
+        auto xi_t0 = t0;
+        field_2.mul_by_nonresidue(xi_t0);
+        auto h3 = xi_t0;
+        h3.add(g3);
+        h3.mul2();
+        h3.add(xi_t0);
+        this->c1.c0 = h3;
+
+        // g2' = 3 * (xi * g5^2 + g1^2) - 2 * g2
+        auto s2 = g5_2;
+        field_2.mul_by_nonresidue(s2);
+        s2.add(g1_2);
+        auto h2 = s2;
+        h2.sub(g2);
+        h2.mul2();
+        h2.add(s2);
+        this->c0.c2 = h2;
+
+        // g1' = 3 * (xi * g2^2 + g3^2) - 2 * g1
+        auto s1 = g2_2;
+        field_2.mul_by_nonresidue(s1);
+        s1.add(g3_2);
+        auto h1 = s1;
+        h1.sub(g1);
+        h1.mul2();
+        h1.add(s1);
+        this->c0.c1 = h1;
+
+        // g5' = 3 * t1 + 2 * g5
+        auto h5 = t1;
+        h5.add(g5);
+        h5.mul2();
+        h5.add(t1);
+        this->c1.c2 = h5;
+    }
 
-        auto found_one = false;
+    // Recovers g0 = c0.c0 and g4 = c1.c1 of compressed elements, with one inversion for all of them:
+    //     g4 = (xi * g5^2 + 3 * g1^2 - 2 * g2) / (4 * g3), or 2 * g1 * g5 / g2 if g3 = 0
+    //     g0 = xi * (2 * g4^2 + g3 * g5 - 3 * g1 * g2) + 1
+    static void batch_decompress(std::vector<Fp12<N>> &elements)
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+        FieldExtension3over2<N> const &field_2 = elements[0].field;
+        auto const one_2 = Fp2<N>::one(field_2);
 
-        for (auto it = RevBitIterator(exp); it.before();)
+        std::vector<Fp2<N>> numerators;
+        std::vector<Fp2<N>> denominators;
+        std::vector<bool> ones;
+        for (auto it = elements.cbegin(); it != elements.cend(); it++)
         {
-            auto const i = *it;
-            if (found_one)
+            auto const &g1 = it->c0.c1;
+            auto const &g2 = it->c0.c2;
+            auto const &g3 = it->c1.c0;
+            auto const &g5 = it->c1.c2;
+
+            // Only 1 has g2 = g3 = 0
+            ones.push_back(g2.is_zero() && g3.is_zero());
+            if (ones.back())
             {
-                res.cyclotomic_square();
+                numerators.push_back(one_2);
+                denominators.push_back(one_2);
+            }
+            else if (g3.is_zero())
+            {
+                auto numerator = g1;
+                numerator.mul(g5);
+                numerator.mul2();
+                numerators.push_back(numerator);
+                denominators.push_back(g2);
             }
             else
             {
-                found_one = i;
+                auto g1_2 = g1;
+                g1_2.square();
+                auto numerator = g5;
+                numerator.square();
+                field_2.mul_by_nonresidue(numerator);
+                numerator.add(g1_2);
+                numerator.add(g1_2);
+                numerator.add(g1_2);
+                numerator.sub(g2);
+                numerator.sub(g2);
+                numerators.push_back(numerator);
+
+                auto denominator = g3;
+                denominator.mul2();
+                denominator.mul2();
+                denominators.push_back(denominator);
+            }
+        }
+
+        auto const inverted = batch_inverse(denominators);
+        UNUSED(inverted);
+        assert(inverted);
+
+        for (usize i = 0; i < elements.size(); i++)
+        {
+            auto &element = elements[i];
+            if (ones[i])
+            {
+                element = element.one();
+                continue;
+            }
+
+            auto g4 = numerators[i];
+            g4.mul(denominators[i]);
+            element.c1.c1 = g4;
+
+            // g0 = xi * (2 * g4^2 + g3 * g5 - 3 * g1 * g2) + 1
+            auto g1_g2 = element.c0.c1;
+            g1_g2.mul(element.c0.c2);
+            auto g0 = g4;
+            g0.square();
+            g0.sub(g1_g2);
+            g0.mul2();
+            g0.sub(g1_g2);
+            auto g3_g5 = element.c1.c0;
+            g3_g5.mul(element.c1.c2);
+            g0.add(g3_g5);
+            field_2.mul_by_nonresidue(g0);
+            g0.add(one_2);
+            element.c0.c0 = g0;
+        }
+    }
+
+    // Same as cyclotomic_exp, but squarings are compressed and the powers at the nonzero digits
+    // of naf are decompressed together, which pays off for exponents with few nonzero digits.
+    Fp12<N> compressed_cyclotomic_exp(std::vector<i64> const &naf) const
+    {
+        if (naf.empty())
+        {
+            return one();
+        }
+
+        std::vector<Fp12<N>> powers;
+        std::vector<bool> negative;
+        auto power = *this;
+        for (usize i = 1; i < naf.size(); i++)
+        {
+            power.compressed_cyclotomic_square();
+            if (naf[i] != 0)
+            {
+                powers.push_back(power);
+                negative.push_back(naf[i] < 0);
+            }
+        }
+        batch_decompress(powers);
+
+        auto res = one();
+        if (naf[0] != 0)
+        {
+            res = *this;
+            if (naf[0] < 0)
+            {
+                res.conjugate();
+            }
+        }
+        for (usize i = 0; i < powers.size(); i++)
+        {
+            // Inverse of a cyclotomic element is its conjugate
+            if (negative[i])
+            {
+                powers[i].conjugate();
+            }
+            res.mul(powers[i]);
+        }
+
+        return res;
+    }
+
+    // Exponentiation by digits of naf from lowest to highest, see into_ternary_wnaf.
+    Fp12<N> cyclotomic_exp(std::vector<i64> const &naf) const
+    {
+        auto res = one();
+        auto self_inverse = *this;
+        self_inverse.conjugate();
+
+        auto found_nonzero = false;
+        for (auto it = naf.crbegin(); it != naf.crend(); it++)
+        {
+            auto const value = *it;
+            if (found_nonzero)
+            {
+                res.cyclotomic_square();
             }
 
-            if (i)
+            if (value != 0)
             {
-                res.mul(*this);
+                found_nonzero = true;
+
+                if (value > 0)
+                {
+                    res.mul(*this);
+                }
+                else
+                {
+                    res.mul(self_inverse);
+                }
             }
         }
 
@@ -220,6 +220,12 @@ public:
         return c0.is_zero() && c1.is_zero();
     }
 
+    void conditional_assign(Fp2<N> const &e, bool choice)
+    {
+        c0.conditional_assign(e.c0, choice);
+        c1.conditional_assign(e.c1, choice);
+    }
+
     bool operator==(Fp2<N> const &other) const
     {
         return c0 == other.c0 && c1 == other.c1;
@@ -240,6 +246,74 @@ public:
         }
         return this->is_non_nth_root_with(n, field.mod() * field.mod());
     }
+
+    // Square root by the complex method: with lambda = sqrt(c0^2 - beta*c1^2) in Fp, the root is
+    // x0 + x1*u for x0 = sqrt((c0 + lambda)/2), or sqrt((c0 - lambda)/2), and x1 = c1/(2*x0).
+    Option<Fp2<N>> sqrt() const
+    {
+        auto const zero = c0.zero();
+        if (c1.is_zero())
+        {
+            // Either c0 or c0/beta is a square in Fp
+            if (auto const root = c0.sqrt())
+            {
+                return Fp2(root.value(), zero, field);
+            }
+
+            auto t = c0;
+            t.mul(field.non_residue().inverse().value());
+            if (auto const root = t.sqrt())
+            {
+                return Fp2(zero, root.value(), field);
+            }
+
+            return {};
+        }
+
+        auto norm = c0;
+        norm.square();
+        auto t = c1;
+        t.square();
+        field.mul_by_nonresidue(t);
+        norm.sub(t);
+        auto const lambda = norm.sqrt();
+        if (!lambda)
+        {
+            return {};
+        }
+
+        auto two = c0.one();
+        two.mul2();
+        auto const two_inv = two.inverse().value();
+        auto delta = c0;
+        delta.add(lambda.value());
+        delta.mul(two_inv);
+        auto x0 = delta.sqrt();
+        if (!x0)
+        {
+            delta = c0;
+            delta.sub(lambda.value());
+            delta.mul(two_inv);
+            x0 = delta.sqrt();
+            if (!x0)
+            {
+                return {};
+            }
+        }
+
+        auto x1 = x0.value();
+        x1.mul2();
+        x1 = x1.inverse().value();
+        x1.mul(c1);
+
+        return Fp2(x0.value(), x1, field);
+    }
+
+    // Sign of the lowest nonzero coefficient.
+    bool sign() const
+    {
+        return c0.is_zero() ? c1.sign() : c0.sign();
+    }
 };
 
 #endif
\ No newline at end of file
@@ -317,6 +317,13 @@ public:
         return c0.is_zero() && c1.is_zero() && c2.is_zero();
     }
 
+    void conditional_assign(Fp3<N> const &e, bool choice)
+    {
+        c0.conditional_assign(e.c0, choice);
+        c1.conditional_assign(e.c1, choice);
+        c2.conditional_assign(e.c2, choice);
+    }
+
     bool operator==(Fp3<N> const &other) const
     {
         return c0 == other.c0 && c1 == other.c1 && c2 == other.c2;
@@ -326,6 +333,26 @@ public:
     {
         return !(*this == other);
     }
+
+    // *************** impl ************ //
+
+    // Fp3 has no quadratic subfield to reduce to, so this exponentiates in the field of p^3 elements.
+    Option<Fp3<N>> sqrt() const
+    {
+        auto const p = field.mod();
+        return this->sqrt_with(p * p * p);
+    }
+
+    // Sign of the lowest nonzero coefficient.
+    bool sign() const
+    {
+        if (!c0.is_zero())
+        {
+            return c0.sign();
+        }
+
+        return c1.is_zero() ? c2.sign() : c1.sign();
+    }
 };
 
 #endif
\ No newline at end of file
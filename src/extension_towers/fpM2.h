@@ -41,7 +41,7 @@ public:
             auto const value = *it;
             if (found_nonzero)
             {
-                res.square();
+                res.cyclotomic_square();
             }
 
             if (value != 0)
@@ -62,6 +62,33 @@ public:
         return res;
     }
 
+    // Squaring of an element of norm c0^2 - xi * c1^2 = 1, such as of the cyclotomic subgroup,
+    // with two squarings in the base field:
+    //     c0' = c0^2 + xi * c1^2 = 2 * xi * c1^2 + 1
+    //     c1' = (c0 + c1)^2 - c0^2 - c1^2 = (c0 + c1)^2 - 1 - xi * c1^2 - c1^2
+    void cyclotomic_square()
+    {
+        auto const one = c0.one();
+        auto c1_2 = c1;
+        c1_2.square();
+        auto xi_c1_2 = c1_2;
+        field.mul_by_nonresidue(xi_c1_2);
+
+        auto e1 = c0;
+        e1.add(c1);
+        e1.square();
+        e1.sub(one);
+        e1.sub(xi_c1_2);
+        e1.sub(c1_2);
+
+        auto e0 = xi_c1_2;
+        e0.mul2();
+        e0.add(one);
+
+        c0 = e0;
+        c1 = e1;
+    }
+
     void conjugate()
     {
         c1.negate();
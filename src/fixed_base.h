@@ -0,0 +1,177 @@
+#ifndef H_FIXED_BASE
+#define H_FIXED_BASE
+
+#include "common.h"
+#include "curve.h"
+#include "table_cache.h"
+#include "extension_towers/fp2.h"
+#include "extension_towers/fp3.h"
+#include <memory>
+
+// Window width of fixed base tables, a table holds 2^(c-1) multiples per window.
+static const u32 FIXED_BASE_WINDOW = 5;
+
+// ****************************** DETACHED ELEMENTS ***************************** //
+// Elements stored as limbs of their representation, bound to a field context again when loaded.
+
+template <usize N>
+void detach(Fp<N> const &e, std::vector<u64> &limbs)
+{
+    auto const &repr = e.representation();
+    limbs.insert(limbs.end(), repr.cbegin(), repr.cend());
+}
+
+template <usize N>
+void detach(Fp2<N> const &e, std::vector<u64> &limbs)
+{
+    detach(e.c0, limbs);
+    detach(e.c1, limbs);
+}
+
+template <usize N>
+void detach(Fp3<N> const &e, std::vector<u64> &limbs)
+{
+    detach(e.c0, limbs);
+    detach(e.c1, limbs);
+    detach(e.c2, limbs);
+}
+
+template <usize N>
+Fp<N> attach(u64 const *limbs, PrimeField<N> const &field)
+{
+    Repr<N> repr;
+    std::copy(limbs, limbs + N, repr.begin());
+    return Fp<N>(repr, field);
+}
+
+template <usize N>
+Fp2<N> attach(u64 const *limbs, FieldExtension2<N> const &field)
+{
+    PrimeField<N> const &base = field;
+    return Fp2<N>(attach(limbs, base), attach(limbs + N, base), field);
+}
+
+template <usize N>
+Fp3<N> attach(u64 const *limbs, FieldExtension3<N> const &field)
+{
+    PrimeField<N> const &base = field;
+    return Fp3<N>(attach(limbs, base), attach(limbs + N, base), attach(limbs + 2 * N, base), field);
+}
+
+// ****************************** FIXED BASE TABLE ***************************** //
+
+// Multiples [d * 2^(c*w)]P for d in [1, 2^(c-1)] and every c bit window w, so multiplying by
+// signed window digits takes a mixed addition per window and no doublings.
+template <class E>
+class FixedBaseTable : public CachedTable
+{
+    u32 c;
+    usize n_windows;
+    usize element_limbs;
+    // x and y of the multiples, window by window
+    std::vector<u64> limbs;
+    std::vector<bool> zeros;
+
+public:
+    // Table for scalars of up to n_bits bits.
+    template <class C>
+    FixedBaseTable(CurvePoint<E> const &base, u32 c, usize n_bits, WeierstrassCurve<E> const &wc, C const &context) : c(c), n_windows(n_bits / c + 1), element_limbs(0)
+    {
+        usize const n_digits = usize(1) << (c - 1);
+        std::vector<CurvePoint<E>> multiples;
+        auto window_base = base;
+        for (usize w = 0; w < n_windows; w++)
+        {
+            multiples.push_back(window_base);
+            for (usize d = 1; d < n_digits; d++)
+            {
+                auto next = multiples.back();
+                next.add(window_base, wc, context);
+                multiples.push_back(next);
+            }
+
+            for (u32 i = 0; i < c; i++)
+            {
+                window_base.mul2(wc);
+            }
+        }
+        CurvePoint<E>::batch_normalize(multiples);
+
+        for (auto it = multiples.cbegin(); it != multiples.cend(); it++)
+        {
+            zeros.push_back(it->is_zero());
+            detach(it->x, limbs);
+            detach(it->y, limbs);
+        }
+        element_limbs = limbs.size() / (2 * multiples.size());
+    }
+
+    usize memory() const override
+    {
+        return limbs.size() * sizeof(u64) + zeros.size() / 8;
+    }
+
+    // None if the scalar is longer than the table allows.
+    template <class C>
+    Option<CurvePoint<E>> mul(std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc, C const &context) const
+    {
+        auto const digits = into_signed_windows(scalar, c);
+        if (digits.size() > n_windows)
+        {
+            return {};
+        }
+
+        usize const n_digits = usize(1) << (c - 1);
+        auto acc = CurvePoint<E>::zero(context);
+        for (usize w = 0; w < digits.size(); w++)
+        {
+            auto const digit = digits[w];
+            if (digit == 0)
+            {
+                continue;
+            }
+
+            auto const k = w * n_digits + (digit > 0 ? digit : -digit) - 1;
+            if (zeros[k])
+            {
+                continue;
+            }
+
+            auto const at = limbs.data() + 2 * k * element_limbs;
+            auto multiple = CurvePoint<E>(attach(at, context), attach(at + element_limbs, context));
+            if (digit < 0)
+            {
+                multiple.negate();
+            }
+            acc.add_mixed(multiple, wc, context);
+        }
+
+        return acc;
+    }
+};
+
+// Multiplies a base by a scalar, through a cached table once the same base was multiplied often enough.
+// Key holds the input bytes the curve and base were deserialized from.
+template <class E, class C>
+CurvePoint<E> mul_fixed_base(std::string const &key, CurvePoint<E> const &base, std::vector<u64> const &scalar, WeierstrassCurve<E> const &wc, C const &context)
+{
+    auto &cache = TableCache::fixed_bases();
+    auto table = std::dynamic_pointer_cast<FixedBaseTable<E> const>(cache.get(key));
+    if (!table && cache.count_use(key))
+    {
+        table = std::make_shared<FixedBaseTable<E> const>(base, FIXED_BASE_WINDOW, num_bits(wc.subgroup_order()), wc, context);
+        cache.insert(key, table);
+    }
+
+    if (table)
+    {
+        if (auto const r = table->mul(scalar, wc, context))
+        {
+            return r.value();
+        }
+    }
+
+    return base.mul(scalar, wc, context);
+}
+
+#endif
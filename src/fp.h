@@ -143,6 +143,16 @@ public:
         return cbn::is_zero(repr);
     }
 
+    // Takes e if choice is set, with no branch on choice.
+    void conditional_assign(Fp<N> const &e, bool choice)
+    {
+        u64 const mask = -u64(choice);
+        for (usize i = 0; i < N; i++)
+        {
+            repr[i] ^= mask & (repr[i] ^ e.repr[i]);
+        }
+    }
+
     bool operator==(Fp<N> const &other) const
     {
         return repr == other.repr;
@@ -160,6 +170,17 @@ public:
         return this->is_non_nth_root_with(n, field.mod());
     }
 
+    Option<Fp<N>> sqrt() const
+    {
+        return this->sqrt_with(field.mod());
+    }
+
+    // Parity of the number, tells e from -e unless e is zero.
+    bool sign() const
+    {
+        return into_repr()[0] & 1;
+    }
+
 private:
     static Option<Fp<N>> from_repr_try(Repr<N> repr, PrimeField<N> const &field)
     {
@@ -250,13 +271,15 @@ private:
 
         // phase 2
 
+        // Moduli much shorter than their limbs can take fewer steps than the Montgomery power,
+        // then r is doubled instead of halved
         auto const mont_power_param = field.mont_power();
-        if (k < mont_power_param)
+        for (usize i = k; i < mont_power_param; i++)
         {
-            return {};
+            r = cbn::mod_add(r, r, modulus);
         }
 
-        for (usize i = 0; i < (k - mont_power_param); i++)
+        for (usize i = mont_power_param; i < k; i++)
         {
             if (cbn::is_even(r))
             {
@@ -3,59 +3,359 @@
 
 #include "curve.h"
 #include "common.h"
+#include "fixed_base.h"
+#include "thread_pool.h"
+#include "window_table.h"
+#include "extension_towers/fp2.h"
+#include "extension_towers/fp3.h"
+#include <unordered_map>
 
-template <class E, class C>
-CurvePoint<E> peepinger(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> pairs, WeierstrassCurve<E> const &wc, C const &context)
+// Up to this many pairs splitting scalars with the curve endomorphism pays off,
+// above it the eigenspace check per point costs more than the saved windows.
+static const usize MAX_ENDOMORPHISM_MULTIEXP_PAIRS = 6;
+
+// From this many pairs buckets are kept affine and filled with batched affine additions.
+static const usize MIN_AFFINE_BUCKETS_MULTIEXP_PAIRS = 16;
+
+// Affine bucket filling prefetches the point of the bucket this many ahead.
+static const usize AFFINE_BUCKETS_PREFETCH_DISTANCE = 4;
+
+// Fewer pairs than this are not split between threads.
+static const usize MIN_MULTIEXP_PAIRS_PER_THREAD = 32;
+
+// Signed c bit window digits of all scalars in one array, window by window,
+// so a bucket pass reads the digits of its window in order.
+class DigitMatrix
 {
+public:
     u32 c;
-    if (pairs.size() < 32)
+    usize n_windows;
+    usize n_points;
+    std::vector<i32> digits;
+
+    i32 get(usize w, usize i) const
     {
-        c = 3;
+        return digits[w * n_points + i];
     }
-    else
+};
+
+// Recodes every scalar once, digits in [-2^(c-1), 2^(c-1)] so a window needs only 2^(c-1) buckets.
+template <class E>
+DigitMatrix recode_scalars(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, u32 c)
+{
+    u32 n_bits = 0;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
     {
-        c = ceil(log((double)pairs.size()));
-    };
+        n_bits = max(n_bits, num_bits(std::get<1>(*it)));
+    }
 
-    std::vector<CurvePoint<E>> windows;
-    std::vector<CurvePoint<E>> buckets;
+    // Carry out of the top window takes at most one more
+    DigitMatrix m;
+    m.c = c;
+    m.n_windows = n_bits / c + 1;
+    m.n_points = pairs.size();
+    m.digits.resize(m.n_windows * m.n_points, 0);
+
+    usize n_used = 0;
+    for (usize i = 0; i < m.n_points; i++)
+    {
+        auto const windows = into_signed_windows(std::get<1>(pairs[i]), c);
+        for (usize w = 0; w < windows.size(); w++)
+        {
+            m.digits[w * m.n_points + i] = i32(windows[w]);
+        }
+        n_used = max(n_used, windows.size());
+    }
+    m.n_windows = n_used;
+    m.digits.resize(m.n_windows * m.n_points);
+
+    return m;
+}
 
-    u64 mask = (u64(1) << c) - u64(1);
-    u32 cur = 0;
-    auto const n_bits = num_bits(wc.subgroup_order());
+// Fills buckets of windows [w_begin, w_end) at once with pairs [p_begin, p_end), keeping them affine.
+// Points are counting sorted by bucket first, then round k adds the k-th point of every bucket
+// that has one, walking buckets in order and sharing one inversion per round.
+// Points holds P_i at 2i and -P_i at 2i + 1, digit d of pair i goes to bucket |d| - 1 with P_i or -P_i.
+// Returns buckets of window w_begin + w at [w * 2^(c-1), (w + 1) * 2^(c-1)).
+template <class E, class C>
+std::vector<CurvePoint<E>> fill_affine_buckets(std::vector<CurvePoint<E>> const &points, DigitMatrix const &digits, usize w_begin, usize w_end, usize p_begin, usize p_end, WeierstrassCurve<E> const &wc, C const &context)
+{
+    usize const n_buckets = usize(1) << (digits.c - 1);
     auto const zero_point = CurvePoint<E>::zero(context);
+    std::vector<CurvePoint<E>> buckets((w_end - w_begin) * n_buckets, zero_point);
+
+    // Points of bucket b are sorted[offsets[b]..offsets[b + 1])
+    std::vector<usize> offsets(buckets.size() + 1, 0);
+    for (usize w = w_begin; w < w_end; w++)
+    {
+        for (usize i = p_begin; i < p_end; i++)
+        {
+            auto const digit = digits.get(w, i);
+            if (digit != 0 && !points[2 * i].is_zero())
+            {
+                offsets[(w - w_begin) * n_buckets + (digit > 0 ? digit : -digit)]++;
+            }
+        }
+    }
+    for (usize b = 0; b < buckets.size(); b++)
+    {
+        offsets[b + 1] += offsets[b];
+    }
+
+    std::vector<usize> sorted(offsets.back());
+    std::vector<usize> next(offsets.cbegin(), offsets.cend() - 1);
+    for (usize w = w_begin; w < w_end; w++)
+    {
+        for (usize i = p_begin; i < p_end; i++)
+        {
+            auto const digit = digits.get(w, i);
+            if (digit != 0 && !points[2 * i].is_zero())
+            {
+                auto const b = (w - w_begin) * n_buckets + (digit > 0 ? digit : -digit) - 1;
+                sorted[next[b]++] = digit > 0 ? 2 * i : 2 * i + 1;
+            }
+        }
+    }
 
-    while (cur <= n_bits)
+    // Buckets with points left, in order
+    std::vector<usize> active;
+    for (usize b = 0; b < buckets.size(); b++)
     {
-        auto acc = zero_point;
+        if (offsets[b] < offsets[b + 1])
+        {
+            active.push_back(b);
+        }
+    }
 
-        buckets.resize(0, zero_point);
-        buckets.resize((1 << c) - 1, zero_point);
+    std::vector<usize> batch;
+    std::vector<E> denominators;
+    for (usize k = 0; !active.empty(); k++)
+    {
+        batch.clear();
+        denominators.clear();
 
-        for (auto it = pairs.begin(); it != pairs.end(); it++)
+        usize n_left = 0;
+        for (usize a = 0; a < active.size(); a++)
         {
-            CurvePoint<E> const &g = std::get<0>(*it);
-            std::vector<u64> &s = std::get<1>(*it);
-            usize const index = s[0] & mask;
+            if (a + AFFINE_BUCKETS_PREFETCH_DISTANCE < active.size())
+            {
+                __builtin_prefetch(&points[sorted[offsets[active[a + AFFINE_BUCKETS_PREFETCH_DISTANCE]] + k]]);
+            }
+
+            auto const b = active[a];
+            if (offsets[b] + k + 1 < offsets[b + 1])
+            {
+                active[n_left++] = b;
+            }
 
-            if (index != 0)
+            auto &bucket = buckets[b];
+            auto const &p = points[sorted[offsets[b] + k]];
+            if (bucket.is_zero())
             {
-                buckets[index - 1].add_mixed(g, wc, context);
+                bucket = p;
+                continue;
             }
 
-            right_shift(s, c);
+            auto denominator = p.x;
+            if (bucket.x == p.x)
+            {
+                // P + (-P) = 0, otherwise doubling with 2y
+                if (bucket.y != p.y || bucket.y.is_zero())
+                {
+                    bucket = zero_point;
+                    continue;
+                }
+                denominator = p.y;
+                denominator.mul2();
+            }
+            else
+            {
+                denominator.sub(bucket.x);
+            }
+
+            batch.push_back(b);
+            denominators.push_back(denominator);
         }
+        active.resize(n_left);
+
+        auto const inverted = batch_inverse(denominators);
+        assert(inverted);
+        UNUSED(inverted);
 
-        auto running_sum = zero_point;
-        for (auto it = buckets.crbegin(); it != buckets.crend(); it++)
+        for (usize j = 0; j < batch.size(); j++)
         {
-            running_sum.add(*it, wc, context);
-            acc.add(running_sum, wc, context);
+            auto &bucket = buckets[batch[j]];
+            auto const &p = points[sorted[offsets[batch[j]] + k]];
+
+            // lambda = (y2 - y1) / (x2 - x1), or (3x^2 + a) / 2y for doubling
+            auto lambda = p.y;
+            if (bucket.x == p.x)
+            {
+                lambda = p.x;
+                lambda.square();
+                auto const x2 = lambda;
+                lambda.mul2();
+                lambda.add(x2);
+                lambda.add(wc.get_a());
+            }
+            else
+            {
+                lambda.sub(bucket.y);
+            }
+            lambda.mul(denominators[j]);
+
+            // x3 = lambda^2 - x1 - x2
+            auto x3 = lambda;
+            x3.square();
+            x3.sub(bucket.x);
+            x3.sub(p.x);
+
+            // y3 = lambda * (x1 - x3) - y1
+            auto y3 = bucket.x;
+            y3.sub(x3);
+            y3.mul(lambda);
+            y3.sub(bucket.y);
+
+            bucket.x = x3;
+            bucket.y = y3;
         }
+    }
 
-        windows.push_back(acc);
+    return buckets;
+}
 
-        cur += c;
+// Fills buckets of window w with pairs [p_begin, p_end) using mixed Jacobian additions,
+// same layout as fill_affine_buckets.
+template <class E, class C>
+std::vector<CurvePoint<E>> fill_jacobian_buckets(std::vector<CurvePoint<E>> const &points, DigitMatrix const &digits, usize w, usize p_begin, usize p_end, WeierstrassCurve<E> const &wc, C const &context)
+{
+    std::vector<CurvePoint<E>> buckets(usize(1) << (digits.c - 1), CurvePoint<E>::zero(context));
+    for (usize i = p_begin; i < p_end; i++)
+    {
+        auto const digit = digits.get(w, i);
+        if (digit > 0)
+        {
+            buckets[digit - 1].add_mixed(points[2 * i], wc, context);
+        }
+        else if (digit < 0)
+        {
+            buckets[-digit - 1].add_mixed(points[2 * i + 1], wc, context);
+        }
+    }
+
+    return buckets;
+}
+
+// Returns sum of [b + 1]buckets[offset + b] for b < n_buckets, with running sums.
+template <class E, class C>
+CurvePoint<E> sum_buckets(std::vector<CurvePoint<E>> const &buckets, usize offset, usize n_buckets, WeierstrassCurve<E> const &wc, C const &context)
+{
+    auto acc = CurvePoint<E>::zero(context);
+    auto running_sum = CurvePoint<E>::zero(context);
+    for (usize b = n_buckets; b > 0; b--)
+    {
+        running_sum.add(buckets[offset + b - 1], wc, context);
+        acc.add(running_sum, wc, context);
+    }
+
+    return acc;
+}
+
+// Replaces pairs by shorter ones if the curve has an endomorphism and their points are in its eigenspace.
+template <class E>
+std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> split_with_endomorphism(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc)
+{
+    auto const endomorphism = wc.endomorphism();
+    if (!endomorphism)
+    {
+        return pairs;
+    }
+
+    std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> split_pairs;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        if (auto const split = endomorphism->split(std::get<0>(*it), std::get<1>(*it), wc))
+        {
+            split_pairs.insert(split_pairs.end(), split.value().cbegin(), split.value().cend());
+        }
+        else
+        {
+            split_pairs.push_back(*it);
+        }
+    }
+
+    return split_pairs;
+}
+
+// Returns sums of windows [w_begin, w_end) over pairs [p_begin, p_end).
+template <class E, class C>
+std::vector<CurvePoint<E>> window_sums(std::vector<CurvePoint<E>> const &points, DigitMatrix const &digits, usize w_begin, usize w_end, usize p_begin, usize p_end, WeierstrassCurve<E> const &wc, C const &context)
+{
+    usize const n_buckets = usize(1) << (digits.c - 1);
+    std::vector<CurvePoint<E>> sums;
+    if (p_end - p_begin >= MIN_AFFINE_BUCKETS_MULTIEXP_PAIRS)
+    {
+        auto const buckets = fill_affine_buckets(points, digits, w_begin, w_end, p_begin, p_end, wc, context);
+        for (usize w = w_begin; w < w_end; w++)
+        {
+            sums.push_back(sum_buckets(buckets, (w - w_begin) * n_buckets, n_buckets, wc, context));
+        }
+    }
+    else
+    {
+        for (usize w = w_begin; w < w_end; w++)
+        {
+            auto const buckets = fill_jacobian_buckets(points, digits, w, p_begin, p_end, wc, context);
+            sums.push_back(sum_buckets(buckets, 0, n_buckets, wc, context));
+        }
+    }
+
+    return sums;
+}
+
+// Sum of window sums over points interleaved with their negations, doubling c times between windows.
+template <class E, class C>
+CurvePoint<E> bucket_sum(std::vector<CurvePoint<E>> const &points, DigitMatrix const &digits, WeierstrassCurve<E> const &wc, C const &context)
+{
+    auto const c = digits.c;
+    auto const n_pairs = digits.n_points;
+    auto const n_windows = digits.n_windows;
+
+    // Windows are split into groups and, if threads are left over, pairs into chunks.
+    // Every task fills buckets of its own and the chunks are summed up per window.
+    auto &pool = ThreadPool::global();
+    auto const n_groups = max(usize(1), min(n_windows, pool.threads()));
+    auto const n_chunks = max(usize(1), min((pool.threads() + n_groups - 1) / n_groups, n_pairs / MIN_MULTIEXP_PAIRS_PER_THREAD));
+    std::vector<std::vector<CurvePoint<E>>> task_sums(n_groups * n_chunks);
+    pool.parallel_for(task_sums.size(), [&](usize task) {
+        auto const group = task % n_groups;
+        auto const chunk = task / n_groups;
+        task_sums[task] = window_sums(points, digits,
+                                      group * n_windows / n_groups, (group + 1) * n_windows / n_groups,
+                                      chunk * n_pairs / n_chunks, (chunk + 1) * n_pairs / n_chunks,
+                                      wc, context);
+    });
+
+    auto const zero_point = CurvePoint<E>::zero(context);
+    std::vector<CurvePoint<E>> windows;
+    for (usize chunk = 0; chunk < n_chunks; chunk++)
+    {
+        for (usize group = 0; group < n_groups; group++)
+        {
+            auto const &sums = task_sums[chunk * n_groups + group];
+            auto const w_begin = group * n_windows / n_groups;
+            for (usize k = 0; k < sums.size(); k++)
+            {
+                if (chunk == 0)
+                {
+                    windows.push_back(sums[k]);
+                }
+                else
+                {
+                    windows[w_begin + k].add(sums[k], wc, context);
+                }
+            }
+        }
     }
 
     auto acc = zero_point;
@@ -73,4 +373,369 @@ CurvePoint<E> peepinger(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>>
     return acc;
 }
 
+// Limbs and extension degree of elements, to look up calibrated windows.
+template <usize N>
+std::tuple<usize, usize> element_shape(Fp<N> const &)
+{
+    return std::tuple(N, 1);
+}
+
+template <usize N>
+std::tuple<usize, usize> element_shape(Fp2<N> const &)
+{
+    return std::tuple(N, 2);
+}
+
+template <usize N>
+std::tuple<usize, usize> element_shape(Fp3<N> const &)
+{
+    return std::tuple(N, 3);
+}
+
+// Window width in bits for Pippenger's method over n_pairs pairs, from the calibrated table if
+// it has an entry, otherwise from the estimate.
+u32 window_width(usize n_pairs, usize limbs, usize degree)
+{
+    if (limbs <= CALIBRATED_MAX_LIMBS && degree <= CALIBRATED_MAX_DEGREE)
+    {
+        for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+        {
+            if (n_pairs <= CALIBRATED_PAIRS[k] || k + 1 == CALIBRATED_PAIRS_COUNT)
+            {
+                if (auto const c = CALIBRATED_WINDOWS[limbs][degree][k])
+                {
+                    return c;
+                }
+                break;
+            }
+        }
+    }
+
+    if (n_pairs < 32)
+    {
+        return 3;
+    }
+
+    return ceil(log((double)n_pairs));
+}
+
+// Pippenger's method with windows of c bits.
+template <class E, class C>
+CurvePoint<E> peepinger_with_window(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, u32 c, WeierstrassCurve<E> const &wc, C const &context)
+{
+    // Points interleaved with their negations, normalized for the faster mixed addition
+    std::vector<CurvePoint<E>> normalized;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        normalized.push_back(std::get<0>(*it));
+    }
+    CurvePoint<E>::batch_normalize(normalized);
+    std::vector<CurvePoint<E>> points;
+    for (auto it = normalized.cbegin(); it != normalized.cend(); it++)
+    {
+        points.push_back(*it);
+        points.push_back(*it);
+        points.back().negate();
+    }
+
+    return bucket_sum(points, recode_scalars(pairs, c), wc, context);
+}
+
+template <class E, class C>
+CurvePoint<E> peepinger(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc, C const &context)
+{
+    if (pairs.empty())
+    {
+        return CurvePoint<E>::zero(context);
+    }
+
+    auto const shape = element_shape(std::get<0>(pairs[0]).x);
+    auto const c = window_width(pairs.size(), std::get<0>(shape), std::get<1>(shape));
+
+    return peepinger_with_window(pairs, c, wc, context);
+}
+
+// ****************************** COMPLETE FORMULAS ***************************** //
+
+// Pippenger's method with the complete formulas of ProjectivePoint. Every digit adds its point, a zero
+// digit into a bucket that is left out of the sum and a negative one the negated point, so the additions
+// done depend on the number of pairs and scalar bits only. Nothing if the formulas fail.
+template <class E, class C>
+Option<CurvePoint<E>> complete_multiexp(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, WeierstrassCurve<E> const &wc, C const &context)
+{
+    auto const zero = ProjectivePoint<E>(CurvePoint<E>::zero(context));
+    if (pairs.empty())
+    {
+        return zero.into_jacobian();
+    }
+
+    auto const shape = element_shape(std::get<0>(pairs[0]).x);
+    auto const digits = recode_scalars(pairs, window_width(pairs.size(), std::get<0>(shape), std::get<1>(shape)));
+    usize const n_buckets = usize(1) << (digits.c - 1);
+
+    std::vector<ProjectivePoint<E>> points;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        points.push_back(ProjectivePoint<E>(std::get<0>(*it)));
+    }
+
+    auto acc = zero;
+    for (usize w = digits.n_windows; w-- > 0;)
+    {
+        for (u32 i = 0; i < digits.c; i++)
+        {
+            acc.mul2(wc);
+        }
+
+        // Bucket 0 takes the zero digits
+        std::vector<ProjectivePoint<E>> buckets(n_buckets + 1, zero);
+        for (usize i = 0; i < digits.n_points; i++)
+        {
+            i32 const d = digits.get(w, i);
+            i32 const sign = d >> 31;
+            auto p = points[i];
+            auto negated = p;
+            negated.y.negate();
+            p.conditional_assign(negated, sign != 0);
+            buckets[(d ^ sign) - sign].add(p, wc);
+        }
+
+        // Bucket k holds the points of digit k, running sums weight it k times
+        auto running = zero;
+        auto window_sum = zero;
+        for (usize k = n_buckets; k > 0; k--)
+        {
+            running.add(buckets[k], wc);
+            window_sum.add(running, wc);
+        }
+        acc.add(window_sum, wc);
+    }
+
+    if (acc.is_degenerate())
+    {
+        return {};
+    }
+
+    return acc.into_jacobian();
+}
+
+// ****************************** PRE-PASS ***************************** //
+
+// Leaves out pairs with a zero scalar or the point at infinity and merges pairs with the same point
+// by adding their scalars. Keys identify the points, e.g. by their encoding.
+// Sums are not reduced by the subgroup order, as multiexp points don't have to be in the subgroup.
+template <class E>
+std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> coalesce_pairs(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &pairs, std::vector<std::string> const &keys)
+{
+    std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> coalesced;
+    std::unordered_map<std::string, usize> index;
+    for (usize i = 0; i < pairs.size(); i++)
+    {
+        if (std::get<0>(pairs[i]).is_zero() || num_bits(std::get<1>(pairs[i])) == 0)
+        {
+            continue;
+        }
+
+        auto const found = index.find(keys[i]);
+        if (found == index.end())
+        {
+            index[keys[i]] = coalesced.size();
+            coalesced.push_back(pairs[i]);
+            continue;
+        }
+
+        add_nocarry(std::get<1>(coalesced[found->second]), std::get<1>(pairs[i]));
+    }
+
+    return coalesced;
+}
+
+// ****************************** STRAUS ***************************** //
+
+// Up to this many pairs Straus' method beats Pippenger.
+static const usize MAX_STRAUS_MULTIEXP_PAIRS = 16;
+
+// Straus' method: one chain of doublings shared by all pairs, every pair adds its precomputed
+// odd multiples [1]P, [3]P, ..., [2^(w-1) - 1]P at nonzero digits of its width-w NAF.
+template <class E, class C>
+CurvePoint<E> straus(std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const &input_pairs, WeierstrassCurve<E> const &wc, C const &context)
+{
+    std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> split_pairs;
+    if (input_pairs.size() <= MAX_ENDOMORPHISM_MULTIEXP_PAIRS)
+    {
+        split_pairs = split_with_endomorphism(input_pairs, wc);
+    }
+    auto const &pairs = split_pairs.empty() ? input_pairs : split_pairs;
+
+    u32 n_bits = 0;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        n_bits = max(n_bits, num_bits(std::get<1>(*it)));
+    }
+    u32 const window = n_bits > 128 ? 5 : 4;
+    usize const table_size = usize(1) << (window - 2);
+
+    // Tables of all pairs share one normalization
+    std::vector<CurvePoint<E>> tables;
+    std::vector<std::vector<i64>> nafs;
+    usize n_digits = 0;
+    for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
+    {
+        auto const &p = std::get<0>(*it);
+        auto p2 = p;
+        p2.mul2(wc);
+
+        tables.push_back(p);
+        for (usize k = 1; k < table_size; k++)
+        {
+            auto next = tables.back();
+            next.add(p2, wc, context);
+            tables.push_back(next);
+        }
+
+        nafs.push_back(into_wnaf(std::get<1>(*it), window));
+        n_digits = max(n_digits, nafs.back().size());
+    }
+    CurvePoint<E>::batch_normalize(tables);
+
+    auto acc = CurvePoint<E>::zero(context);
+    for (auto d = n_digits; d > 0; d--)
+    {
+        acc.mul2(wc);
+
+        for (usize i = 0; i < nafs.size(); i++)
+        {
+            if (d > nafs[i].size())
+            {
+                continue;
+            }
+
+            auto const digit = nafs[i][d - 1];
+            if (digit > 0)
+            {
+                acc.add_mixed(tables[i * table_size + (digit - 1) / 2], wc, context);
+            }
+            else if (digit < 0)
+            {
+                auto negated = tables[i * table_size + (-digit - 1) / 2];
+                negated.negate();
+                acc.add_mixed(negated, wc, context);
+            }
+        }
+    }
+
+    return acc;
+}
+
+// ****************************** BATCH SUBGROUP CHECK ***************************** //
+
+// From this many points on subgroup checks without a dedicated test are batched.
+static const usize MIN_BATCH_SUBGROUP_CHECK_POINTS = 8;
+
+// Points checked by one task of the thread pool when a batch fails.
+static const usize BATCH_SUBGROUP_CHECK_CHUNK = 4;
+
+// Finalizer of splitmix64, spreads every bit of x over the result.
+inline u64 mix_bits(u64 x)
+{
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
+
+// Nonzero 64 bit coefficients for a batch check, derived from a hash of all points, so that
+// the result of a check only depends on the input.
+template <class E>
+std::vector<u64> batch_coefficients(std::vector<CurvePoint<E>> const &points)
+{
+    u64 seed = points.size();
+    std::vector<u64> limbs;
+    for (auto it = points.cbegin(); it != points.cend(); it++)
+    {
+        limbs.clear();
+        detach(it->x, limbs);
+        detach(it->y, limbs);
+        detach(it->z, limbs);
+        for (auto limb = limbs.cbegin(); limb != limbs.cend(); limb++)
+        {
+            seed = mix_bits(seed ^ *limb);
+        }
+    }
+
+    std::vector<u64> coefficients;
+    for (usize i = 0; i < points.size(); i++)
+    {
+        auto coefficient = mix_bits(seed + i);
+        coefficients.push_back(coefficient == 0 ? 1 : coefficient);
+    }
+
+    return coefficients;
+}
+
+// Checks every point on its own, chunks of points are spread over the thread pool.
+// Returns index of the first point not in the subgroup, or nothing if all of them are.
+template <class E, class C>
+Option<usize> find_point_not_in_subgroup(std::vector<CurvePoint<E>> const &points, WeierstrassCurve<E> const &wc, C const &context)
+{
+    auto const n_chunks = (points.size() + BATCH_SUBGROUP_CHECK_CHUNK - 1) / BATCH_SUBGROUP_CHECK_CHUNK;
+
+    std::vector<usize> bad_indexes(n_chunks, points.size());
+    ThreadPool::global().parallel_for(n_chunks, [&](usize chunk) {
+        auto const begin = chunk * BATCH_SUBGROUP_CHECK_CHUNK;
+        auto const end = min(begin + BATCH_SUBGROUP_CHECK_CHUNK, points.size());
+        for (auto i = begin; i < end; i++)
+        {
+            if (!points[i].check_correct_subgroup(wc, context))
+            {
+                bad_indexes[chunk] = i;
+                return;
+            }
+        }
+    });
+
+    for (auto it = bad_indexes.cbegin(); it != bad_indexes.cend(); it++)
+    {
+        if (*it < points.size())
+        {
+            return *it;
+        }
+    }
+
+    return {};
+}
+
+// Subgroup check of all points. When there are enough of them and the curve has no dedicated test,
+// sum of [c_i]P_i is multiplied by the order instead. A point outside of the subgroup is missed only
+// if the coefficients cancel its component outside of it. If the sum is not in the subgroup, points
+// are checked one by one.
+template <class E, class C>
+bool check_correct_subgroup(std::vector<CurvePoint<E>> const &points, WeierstrassCurve<E> const &wc, C const &context)
+{
+    if (wc.subgroup_test() || points.size() < MIN_BATCH_SUBGROUP_CHECK_POINTS)
+    {
+        for (auto it = points.cbegin(); it != points.cend(); it++)
+        {
+            if (!it->check_correct_subgroup(wc, context))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto const coefficients = batch_coefficients(points);
+    std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> pairs;
+    for (usize i = 0; i < points.size(); i++)
+    {
+        pairs.push_back(std::tuple(points[i], std::vector<u64>{coefficients[i]}));
+    }
+    if (peepinger(pairs, wc, context).check_correct_subgroup(wc, context))
+    {
+        return true;
+    }
+
+    return !find_point_not_in_subgroup(points, wc, context);
+}
+
 #endif
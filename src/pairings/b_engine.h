@@ -3,20 +3,35 @@
 
 #include "../common.h"
 #include "../curve.h"
+#include "../endomorphism.h"
 #include "../fp.h"
 #include "../extension_towers/fp2.h"
 #include "../extension_towers/fp6_3.h"
 #include "../extension_towers/fp12.h"
+#include "parallel_miller_loop.h"
+#include "prepared_g2.h"
 
 template <usize N>
 using ThreePoint = std::tuple<Fp2<N>, Fp2<N>, Fp2<N>>;
 
+// G1 point of a pair with the line coefficients of its G2 point
+template <usize N>
+using PreparedPair = std::tuple<CurvePoint<Fp<N>>, std::shared_ptr<PreparedG2Table<Fp2<N>> const>>;
+
+// Exponentiation by u uses compressed squarings if at most one in this many digits of its NAF is
+// nonzero, decompression at every nonzero digit costs about as much as compression saves on four
+// squarings.
+static const u32 MIN_COMPRESSED_EXP_DIGITS_PER_WEIGHT = 4;
+
 template <usize N>
 class Bengine
 {
 protected:
     std::vector<u64> u;
     bool u_is_negative;
+    // Signed digits of |u| for exp_by_x
+    std::vector<i64> u_naf;
+    bool u_is_sparse;
     TwistType twist_type;
     WeierstrassCurve<Fp2<N>> const &curve_twist;
 
@@ -24,24 +39,107 @@ public:
     Bengine(std::vector<u64> u,
             bool u_is_negative,
             TwistType twist_type,
-            WeierstrassCurve<Fp2<N>> const &curve_twist) : u(u), u_is_negative(u_is_negative), twist_type(twist_type), curve_twist(curve_twist) {}
+            WeierstrassCurve<Fp2<N>> const &curve_twist) : u(u), u_is_negative(u_is_negative), u_naf(into_ternary_wnaf(u)), u_is_sparse(false), twist_type(twist_type), curve_twist(curve_twist)
+    {
+        usize weight = 0;
+        for (auto it = u_naf.cbegin(); it != u_naf.cend(); it++)
+        {
+            weight += *it != 0;
+        }
+        u_is_sparse = MIN_COMPRESSED_EXP_DIGITS_PER_WEIGHT * weight <= u_naf.size();
+    }
 
+    // G2 points are looked up in the cache of prepared points by their keys.
     std::optional<Fp12<N>>
-    pair(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<Fp2<N>>>> const &points, FieldExtension2over3over2<N> const &context) const
+    pair(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<Fp2<N>>>> const &points, std::vector<std::string> const &g2_keys, FieldExtension2over3over2<N> const &context) const
     {
         if (points.size() == 0)
         {
             return {};
         }
-        auto res = miller_loop(points, context);
+
+        // Pairs with a zero point contribute nothing. G2 points of all pairs are prepared before
+        // the split, so that those missing from the cache are prepared together.
+        std::vector<CurvePoint<Fp<N>>> g1_points;
+        std::vector<CurvePoint<Fp2<N>>> g2_points;
+        std::vector<std::string> keys;
+        for (usize j = 0; j < points.size(); j++)
+        {
+            auto const p = std::get<0>(points[j]);
+            auto const q = std::get<1>(points[j]);
+            if (!p.is_zero() && !q.is_zero())
+            {
+                g1_points.push_back(p);
+                g2_points.push_back(q);
+                keys.push_back(g2_keys[j]);
+            }
+        }
+        auto const tables = prepare_all(g2_points, keys, context);
+
+        std::vector<PreparedPair<N>> pairs;
+        for (usize j = 0; j < g1_points.size(); j++)
+        {
+            pairs.push_back(std::tuple(g1_points[j], tables[j]));
+        }
+
+        auto res = parallel_miller_loop<Fp12<N>>(pairs, [&](auto const &chunk_pairs) {
+            return miller_loop(chunk_pairs, context);
+        });
         return final_exponentiation(res);
     }
 
+    // Replaces multiplication by the group order in subgroup checks if the curves belong to the engine's family.
+    virtual void set_subgroup_tests(WeierstrassCurve<Fp<N>> &g1_curve, WeierstrassCurve<Fp2<N>> &g2_curve, FieldExtension2<N> const &field, Fp2<N> const &non_residue) const = 0;
+
 protected:
-    virtual Fp12<N> miller_loop(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<Fp2<N>>>> const &points, FieldExtension2over3over2<N> const &context) const = 0;
+    virtual Fp12<N> miller_loop(std::vector<PreparedPair<N>> const &pairs, FieldExtension2over3over2<N> const &context) const = 0;
 
     virtual std::vector<ThreePoint<N>> prepare(CurvePoint<Fp2<N>> const &twist_point, FieldExtension2over3over2<N> const &context) const = 0;
 
+    // Preparation of many points at once in affine coordinates, see affine_doubling_steps.
+    // None if some step would divide by zero.
+    virtual Option<std::vector<std::vector<ThreePoint<N>>>> prepare_affine(std::vector<CurvePoint<Fp2<N>>> const &twist_points, FieldExtension2over3over2<N> const &context) const = 0;
+
+    // Line coefficients of G2 points, taken from the cache for points prepared before.
+    std::vector<std::shared_ptr<PreparedG2Table<Fp2<N>> const>> prepare_all(std::vector<CurvePoint<Fp2<N>>> const &twist_points, std::vector<std::string> const &keys, FieldExtension2over3over2<N> const &context) const
+    {
+        return prepared_g2_tables<Fp2<N>>(keys, [&](std::vector<usize> const &missing) {
+            std::vector<CurvePoint<Fp2<N>>> missing_points;
+            for (auto it = missing.cbegin(); it != missing.cend(); it++)
+            {
+                missing_points.push_back(twist_points[*it]);
+            }
+
+            std::vector<std::vector<ThreePoint<N>>> prepared;
+            if (missing_points.size() >= MIN_AFFINE_PREPARE_POINTS)
+            {
+                if (auto const affine = prepare_affine(missing_points, context))
+                {
+                    prepared = affine.value();
+                }
+            }
+            if (prepared.empty())
+            {
+                for (auto it = missing_points.cbegin(); it != missing_points.cend(); it++)
+                {
+                    prepared.push_back(prepare(*it, context));
+                }
+            }
+
+            std::vector<std::vector<Fp2<N>>> elements(prepared.size());
+            for (usize k = 0; k < prepared.size(); k++)
+            {
+                for (auto it = prepared[k].cbegin(); it != prepared[k].cend(); it++)
+                {
+                    elements[k].push_back(std::get<0>(*it));
+                    elements[k].push_back(std::get<1>(*it));
+                    elements[k].push_back(std::get<2>(*it));
+                }
+            }
+            return elements;
+        });
+    }
+
     virtual std::optional<Fp12<N>> final_exponentiation(Fp12<N> const &f) const = 0;
 
     ThreePoint<N> doubling_step(
@@ -125,6 +223,7 @@ protected:
         // Z = 2*Y^3*Z
         r.z = b;
         r.z.mul(h);
+        r.state = PointState::Jacobian;
 
         // 3*X^2
         auto j_by_three = j;
@@ -144,6 +243,125 @@ protected:
         unreachable("");
     }
 
+    // Doubles affine points rs, pushing their tangents to ell_coeffs. Denominators 2y of all points
+    // are inverted at once, false if one of them is zero.
+    bool affine_doubling_steps(
+        std::vector<CurvePoint<Fp2<N>>> &rs,
+        std::vector<std::vector<ThreePoint<N>>> &ell_coeffs,
+        FieldExtension2<N> const &field) const
+    {
+        std::vector<Fp2<N>> denominators;
+        for (auto it = rs.cbegin(); it != rs.cend(); it++)
+        {
+            auto denominator = it->y;
+            denominator.mul2();
+            denominators.push_back(denominator);
+        }
+        if (!batch_inverse(denominators))
+        {
+            return false;
+        }
+
+        for (usize i = 0; i < rs.size(); i++)
+        {
+            auto &r = rs[i];
+
+            // lambda = 3x^2 / 2y
+            auto lambda = r.x;
+            lambda.square();
+            auto const x2 = lambda;
+            lambda.mul2();
+            lambda.add(x2);
+            lambda.mul(denominators[i]);
+
+            ell_coeffs[i].push_back(affine_line(lambda, r.x, r.y, field));
+
+            // x3 = lambda^2 - 2x, y3 = lambda * (x - x3) - y
+            auto x3 = lambda;
+            x3.square();
+            x3.sub(r.x);
+            x3.sub(r.x);
+            auto y3 = r.x;
+            y3.sub(x3);
+            y3.mul(lambda);
+            y3.sub(r.y);
+
+            r = CurvePoint<Fp2<N>>(x3, y3);
+        }
+
+        return true;
+    }
+
+    // Adds affine points qs to affine points rs, pushing lines through them to ell_coeffs.
+    // Denominators of all points are inverted at once, false if one of them is zero.
+    bool affine_addition_steps(
+        std::vector<CurvePoint<Fp2<N>>> &rs,
+        std::vector<CurvePoint<Fp2<N>>> const &qs,
+        std::vector<std::vector<ThreePoint<N>>> &ell_coeffs,
+        FieldExtension2<N> const &field) const
+    {
+        std::vector<Fp2<N>> denominators;
+        for (usize i = 0; i < rs.size(); i++)
+        {
+            auto denominator = qs[i].x;
+            denominator.sub(rs[i].x);
+            denominators.push_back(denominator);
+        }
+        if (!batch_inverse(denominators))
+        {
+            return false;
+        }
+
+        for (usize i = 0; i < rs.size(); i++)
+        {
+            auto &r = rs[i];
+            auto const &q = qs[i];
+
+            // lambda = (y2 - y1) / (x2 - x1)
+            auto lambda = q.y;
+            lambda.sub(r.y);
+            lambda.mul(denominators[i]);
+
+            ell_coeffs[i].push_back(affine_line(lambda, r.x, r.y, field));
+
+            // x3 = lambda^2 - x1 - x2, y3 = lambda * (x1 - x3) - y1
+            auto x3 = lambda;
+            x3.square();
+            x3.sub(r.x);
+            x3.sub(q.x);
+            auto y3 = r.x;
+            y3.sub(x3);
+            y3.mul(lambda);
+            y3.sub(r.y);
+
+            r = CurvePoint<Fp2<N>>(x3, y3);
+        }
+
+        return true;
+    }
+
+    // Line through (x, y) with slope lambda, -y_P + lambda * x_P + (y - lambda * x). Projective steps
+    // give the same line times a factor from Fp2, which the final exponentiation removes.
+    ThreePoint<N> affine_line(Fp2<N> const &lambda, Fp2<N> const &x, Fp2<N> const &y, FieldExtension2<N> const &field) const
+    {
+        auto minus_one = Fp2<N>::one(field);
+        minus_one.negate();
+
+        auto c = lambda;
+        c.mul(x);
+        c.negate();
+        c.add(y);
+
+        switch (twist_type)
+        {
+        case M:
+            return std::tuple(c, lambda, minus_one);
+        case D:
+            return std::tuple(minus_one, lambda, c);
+        }
+        unreachable("");
+    }
+
     ThreePoint<N> addition_step(
         CurvePoint<Fp2<N>> &r,
         CurvePoint<Fp2<N>> const &q) const
@@ -205,6 +423,7 @@ protected:
 
         // Z = Lambda^3 * Z
         r.z.mul(e);
+        r.state = PointState::Jacobian;
 
         // Lambda*y
         auto t1 = lambda;
@@ -228,6 +447,20 @@ protected:
         unreachable("");
     }
 
+    // Line coefficients of a prepared G2 point, as they come out of prepare.
+    std::vector<ThreePoint<N>> line_coefficients(PreparedG2Table<Fp2<N>> const &table, FieldExtension2over3over2<N> const &context) const
+    {
+        FieldExtension2<N> const &extension2 = context;
+        auto const elements = table.elements(extension2);
+        std::vector<ThreePoint<N>> ell_coeffs;
+        for (usize i = 0; i < elements.size(); i += 3)
+        {
+            ell_coeffs.push_back(std::tuple(elements[i], elements[i + 1], elements[i + 2]));
+        }
+
+        return ell_coeffs;
+    }
+
     void for_ell(Fp12<N> &f, usize n, std::vector<CurvePoint<Fp<N>>> const &g1_references, std::vector<std::vector<ThreePoint<N>>> const &prepared_coeffs, std::vector<usize> &pc_indexes) const
     {
         for (usize j = 0; j < n; j++)
@@ -270,7 +503,14 @@ protected:
 
     void exp_by_x(Fp12<N> &f) const
     {
-        f = f.cyclotomic_exp(this->u);
+        if (u_is_sparse)
+        {
+            f = f.compressed_cyclotomic_exp(u_naf);
+        }
+        else
+        {
+            f = f.cyclotomic_exp(u_naf);
+        }
         if (u_is_negative)
         {
             f.conjugate();
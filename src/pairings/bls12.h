@@ -21,22 +21,20 @@ public:
         }
     }
 
+    void set_subgroup_tests(WeierstrassCurve<Fp<N>> &g1_curve, WeierstrassCurve<Fp2<N>> &g2_curve, FieldExtension2<N> const &field, Fp2<N> const &non_residue) const
+    {
+        set_bls12_subgroup_tests(this->u, this->u_is_negative, this->twist_type, g1_curve, g2_curve, field, non_residue);
+    }
+
 protected:
-    Fp12<N> miller_loop(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<Fp2<N>>>> const &points, FieldExtension2over3over2<N> const &context) const
+    Fp12<N> miller_loop(std::vector<PreparedPair<N>> const &pairs, FieldExtension2over3over2<N> const &context) const
     {
         std::vector<CurvePoint<Fp<N>>> g1_references;
         std::vector<std::vector<ThreePoint<N>>> prepared_coeffs;
-
-        for (auto it = points.cbegin(); it != points.cend(); it++)
+        for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
         {
-            auto const p = std::get<0>(*it);
-            auto const q = std::get<1>(*it);
-            if (!p.is_zero() && !q.is_zero())
-            {
-                auto coeffs = prepare(q, context);
-                prepared_coeffs.push_back(coeffs);
-                g1_references.push_back(p);
-            }
+            g1_references.push_back(std::get<0>(*it));
+            prepared_coeffs.push_back(this->line_coefficients(*std::get<1>(*it), context));
         }
 
         auto const n = prepared_coeffs.size();
@@ -100,6 +98,29 @@ protected:
         return ell_coeffs;
     }
 
+    Option<std::vector<std::vector<ThreePoint<N>>>> prepare_affine(std::vector<CurvePoint<Fp2<N>>> const &twist_points, FieldExtension2over3over2<N> const &context) const
+    {
+        std::vector<std::vector<ThreePoint<N>>> ell_coeffs(twist_points.size());
+        auto rs = twist_points;
+
+        auto it = RevBitIterator(this->u);
+        it.before(); //skip 1
+        for (; it.before();)
+        {
+            if (!this->affine_doubling_steps(rs, ell_coeffs, context))
+            {
+                return {};
+            }
+
+            if (*it && !this->affine_addition_steps(rs, twist_points, ell_coeffs, context))
+            {
+                return {};
+            }
+        }
+
+        return ell_coeffs;
+    }
+
     std::optional<Fp12<N>> final_exponentiation(Fp12<N> const &f) const
     {
         // Computing the final exponentation following
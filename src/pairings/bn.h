@@ -32,23 +32,20 @@ public:
         non_residue_in_p_minus_one_over_2 = non_residue.pow(p_minus_one_over_2);
     }
 
-protected:
-    Fp12<N> miller_loop(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<Fp2<N>>>> const &points, FieldExtension2over3over2<N> const &context) const
+    void set_subgroup_tests(WeierstrassCurve<Fp<N>> &g1_curve, WeierstrassCurve<Fp2<N>> &g2_curve, FieldExtension2<N> const &field, Fp2<N> const &non_residue) const
     {
+        set_bn_subgroup_tests(this->u, this->u_is_negative, this->twist_type, g1_curve, g2_curve, field, non_residue);
+    }
 
+protected:
+    Fp12<N> miller_loop(std::vector<PreparedPair<N>> const &pairs, FieldExtension2over3over2<N> const &context) const
+    {
         std::vector<CurvePoint<Fp<N>>> g1_references;
         std::vector<std::vector<ThreePoint<N>>> prepared_coeffs;
-
-        for (auto it = points.cbegin(); it != points.cend(); it++)
+        for (auto it = pairs.cbegin(); it != pairs.cend(); it++)
         {
-            auto const p = std::get<0>(*it);
-            auto const q = std::get<1>(*it);
-            if (!p.is_zero() && !q.is_zero())
-            {
-                auto coeffs = prepare(q, context);
-                prepared_coeffs.push_back(coeffs);
-                g1_references.push_back(p);
-            }
+            g1_references.push_back(std::get<0>(*it));
+            prepared_coeffs.push_back(this->line_coefficients(*std::get<1>(*it), context));
         }
 
         auto const n = prepared_coeffs.size();
@@ -141,6 +138,59 @@ protected:
         return ell_coeffs;
     }
 
+    Option<std::vector<std::vector<ThreePoint<N>>>> prepare_affine(std::vector<CurvePoint<Fp2<N>>> const &twist_points, FieldExtension2over3over2<N> const &context) const
+    {
+        std::vector<std::vector<ThreePoint<N>>> ell_coeffs(twist_points.size());
+        auto rs = twist_points;
+
+        auto it = RevBitIterator(six_u_plus_2);
+        it.before(); //skip 1
+        for (; it.before();)
+        {
+            if (!this->affine_doubling_steps(rs, ell_coeffs, context))
+            {
+                return {};
+            }
+
+            if (*it && !this->affine_addition_steps(rs, twist_points, ell_coeffs, context))
+            {
+                return {};
+            }
+        }
+
+        if (this->u_is_negative)
+        {
+            for (auto it = rs.begin(); it != rs.end(); it++)
+            {
+                it->negate();
+            }
+        }
+
+        FieldExtension3over2<N> const &field_3_2 = context;
+        std::vector<CurvePoint<Fp2<N>>> qs;
+        std::vector<CurvePoint<Fp2<N>>> minusq2s;
+        for (auto it = twist_points.cbegin(); it != twist_points.cend(); it++)
+        {
+            auto q = *it;
+            q.x.c1.negate();
+            q.x.mul(field_3_2.frobenius_coeffs_c1[1]);
+            q.y.c1.negate();
+            q.y.mul(non_residue_in_p_minus_one_over_2);
+            qs.push_back(q);
+
+            auto minusq2 = *it;
+            minusq2.x.mul(field_3_2.frobenius_coeffs_c1[2]);
+            minusq2s.push_back(minusq2);
+        }
+
+        if (!this->affine_addition_steps(rs, qs, ell_coeffs, context) || !this->affine_addition_steps(rs, minusq2s, ell_coeffs, context))
+        {
+            return {};
+        }
+
+        return ell_coeffs;
+    }
+
     std::optional<Fp12<N>> final_exponentiation(Fp12<N> const &f) const
     {
         // use Zexe and pairing crate fused
@@ -6,6 +6,8 @@
 #include "../fp.h"
 #include "../extension_towers/fp2.h"
 #include "../extension_towers/fp4.h"
+#include "parallel_miller_loop.h"
+#include "prepared_g2.h"
 
 template <class F, usize N>
 struct AteDoubleCoefficients
@@ -56,44 +58,62 @@ public:
     {
     }
 
+    // G2 points are looked up in the cache of prepared points by their keys.
     template <class C>
     std::optional<F2>
-    pair(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F1>>> const &points, C const &context) const
+    pair(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F1>>> const &points, std::vector<std::string> const &g2_keys, C const &context) const
     {
         if (points.size() == 0)
         {
             return {};
         }
-        auto res = miller_loop(points, context);
+
+        // G2 points of all pairs are prepared before the split, so that those missing from the cache
+        // are prepared together.
+        auto const twist_inv = this->twist.inverse().value();
+        std::vector<CurvePoint<F1>> g2_points;
+        for (auto it = points.cbegin(); it != points.cend(); it++)
+        {
+            assert(std::get<1>(*it).is_normalized());
+            g2_points.push_back(std::get<1>(*it));
+        }
+        auto const g2_prepared = precompute_g2_all(g2_points, g2_keys, twist_inv, context);
+
+        std::vector<std::tuple<CurvePoint<Fp<N>>, PrecomputedG2<F1, N>>> pairs;
+        for (usize i = 0; i < points.size(); i++)
+        {
+            pairs.push_back(std::tuple(std::get<0>(points[i]), g2_prepared[i]));
+        }
+
+        auto res = parallel_miller_loop<F2>(pairs, [&](auto const &chunk_pairs) {
+            return miller_loop(chunk_pairs, context);
+        });
         return final_exponentiation(res);
     }
 
 private:
+    // Pairs share one accumulator, so every bit of x takes a single squaring and a single
+    // inversion is left for negative x.
     template <class C>
-    F2 miller_loop(std::vector<std::tuple<CurvePoint<Fp<N>>, CurvePoint<F1>>> const &points, C const &context) const
+    F2 miller_loop(std::vector<std::tuple<CurvePoint<Fp<N>>, PrecomputedG2<F1, N>>> const &points, C const &context) const
     {
-        auto f = F2::one(context);
+        std::vector<PrecomputedG1<F1, N>> g1_prepared;
+        std::vector<PrecomputedG2<F1, N>> g2_prepared;
         for (auto it = points.cbegin(); it != points.cend(); it++)
         {
-            f.mul(ate_pairing_loop(std::get<0>(*it), std::get<1>(*it), context));
+            assert(std::get<0>(*it).is_normalized());
+            g1_prepared.push_back(precompute_g1(std::get<0>(*it)));
+            g2_prepared.push_back(std::get<1>(*it));
         }
-        return f;
-    }
 
-    template <class C>
-    F2 ate_pairing_loop(
-        CurvePoint<Fp<N>> const &point,
-        CurvePoint<F1> const &twist_point, C const &context) const
-    {
-        assert(point.is_normalized());
-        assert(twist_point.is_normalized());
-        auto const twist_inv = this->twist.inverse().value();
-
-        auto const p = precompute_g1(point);
-        auto const q = precompute_g2(twist_point, twist_inv, context);
-        auto l1_coeff = F1::zero(context);
-        l1_coeff.c0 = p.x;
-        l1_coeff.sub(q.x_over_twist);
+        std::vector<F1> l1_coeffs;
+        for (usize i = 0; i < points.size(); i++)
+        {
+            auto l1_coeff = F1::zero(context);
+            l1_coeff.c0 = g1_prepared[i].x;
+            l1_coeff.sub(g2_prepared[i].x_over_twist);
+            l1_coeffs.push_back(l1_coeff);
+        }
 
         auto f = F2::one(context);
 
@@ -104,78 +124,77 @@ private:
         it.before(); // skip 1
         while (it.before())
         {
-            auto const bit = *it;
-
-            auto const dc = q.double_coefficients[dbl_idx];
-            dbl_idx += 1;
-
-            auto g_rr_at_p = F2::zero(context);
-
-            auto t0 = dc.c_j;
-            t0.mul(p.x_by_twist);
-            t0.negate();
-            t0.add(dc.c_l);
-            t0.sub(dc.c_4c);
-
-            auto t1 = dc.c_h;
-            t1.mul(p.y_by_twist);
-
-            g_rr_at_p.c0 = t0;
-            g_rr_at_p.c1 = t1;
-
             f.square();
-            f.mul(g_rr_at_p);
+            for (usize i = 0; i < points.size(); i++)
+            {
+                f.mul(doubling_line(g1_prepared[i], g2_prepared[i].double_coefficients[dbl_idx], context));
+            }
+            dbl_idx += 1;
 
-            if (bit)
+            if (*it)
             {
-                auto const ac = q.addition_coefficients[add_idx];
+                for (usize i = 0; i < points.size(); i++)
+                {
+                    f.mul(addition_line(g1_prepared[i], g2_prepared[i], l1_coeffs[i], g2_prepared[i].addition_coefficients[add_idx], context));
+                }
                 add_idx += 1;
+            }
+        }
 
-                auto g_rq_at_p = F2::zero(context);
-
-                auto t0 = ac.c_rz;
-                t0.mul(p.y_by_twist);
+        if (this->x_is_negative)
+        {
+            for (usize i = 0; i < points.size(); i++)
+            {
+                f.mul(addition_line(g1_prepared[i], g2_prepared[i], l1_coeffs[i], g2_prepared[i].addition_coefficients[add_idx], context));
+            }
+            f = f.inverse().value();
+        }
 
-                auto t = l1_coeff;
-                t.mul(ac.c_l1);
+        return f;
+    }
 
-                auto t1 = q.y_over_twist;
-                t1.mul(ac.c_rz);
-                t1.add(t);
-                t1.negate();
+    // Doubling line at p
+    template <class C>
+    F2 doubling_line(PrecomputedG1<F1, N> const &p, AteDoubleCoefficients<F1, N> const &dc, C const &context) const
+    {
+        auto g_rr_at_p = F2::zero(context);
 
-                g_rq_at_p.c0 = t0;
-                g_rq_at_p.c1 = t1;
+        auto t0 = dc.c_j;
+        t0.mul(p.x_by_twist);
+        t0.negate();
+        t0.add(dc.c_l);
+        t0.sub(dc.c_4c);
 
-                f.mul(g_rq_at_p);
-            }
-        }
+        auto t1 = dc.c_h;
+        t1.mul(p.y_by_twist);
 
-        if (this->x_is_negative)
-        {
-            auto const ac = q.addition_coefficients[add_idx];
+        g_rr_at_p.c0 = t0;
+        g_rr_at_p.c1 = t1;
 
-            auto g_rnegr_at_p = F2::zero(context);
+        return g_rr_at_p;
+    }
 
-            auto t0 = ac.c_rz;
-            t0.mul(p.y_by_twist);
+    // Addition line at p
+    template <class C>
+    F2 addition_line(PrecomputedG1<F1, N> const &p, PrecomputedG2<F1, N> const &q, F1 const &l1_coeff, AteAdditionCoefficients<F1, N> const &ac, C const &context) const
+    {
+        auto g_rq_at_p = F2::zero(context);
 
-            auto t = l1_coeff;
-            t.mul(ac.c_l1);
+        auto t0 = ac.c_rz;
+        t0.mul(p.y_by_twist);
 
-            auto t1 = q.y_over_twist;
-            t1.mul(ac.c_rz);
-            t1.add(t);
-            t1.negate();
+        auto t = l1_coeff;
+        t.mul(ac.c_l1);
 
-            g_rnegr_at_p.c0 = t0;
-            g_rnegr_at_p.c1 = t1;
+        auto t1 = q.y_over_twist;
+        t1.mul(ac.c_rz);
+        t1.add(t);
+        t1.negate();
 
-            f.mul(g_rnegr_at_p);
-            f = f.inverse().value();
-        }
+        g_rq_at_p.c0 = t0;
+        g_rq_at_p.c1 = t1;
 
-        return f;
+        return g_rq_at_p;
     }
 
     PrecomputedG1<F1, N> precompute_g1(CurvePoint<Fp<N>> const &g1_point) const
@@ -261,6 +280,197 @@ private:
         return g2_p;
     }
 
+    // Coefficients of G2 points, taken from the cache for points prepared before.
+    template <class C>
+    std::vector<PrecomputedG2<F1, N>> precompute_g2_all(std::vector<CurvePoint<F1>> const &g2_points, std::vector<std::string> const &keys, F1 const &twist_inv, C const &context) const
+    {
+        auto const tables = prepared_g2_tables<F1>(keys, [&](std::vector<usize> const &missing) {
+            std::vector<CurvePoint<F1>> missing_points;
+            for (auto it = missing.cbegin(); it != missing.cend(); it++)
+            {
+                missing_points.push_back(g2_points[*it]);
+            }
+
+            std::vector<PrecomputedG2<F1, N>> prepared;
+            if (missing_points.size() >= MIN_AFFINE_PREPARE_POINTS)
+            {
+                if (auto const affine = precompute_g2_affine(missing_points, twist_inv, context))
+                {
+                    prepared = affine.value();
+                }
+            }
+            if (prepared.empty())
+            {
+                for (auto it = missing_points.cbegin(); it != missing_points.cend(); it++)
+                {
+                    prepared.push_back(precompute_g2(*it, twist_inv, context));
+                }
+            }
+
+            std::vector<std::vector<F1>> elements;
+            for (auto it = prepared.cbegin(); it != prepared.cend(); it++)
+            {
+                elements.push_back({it->x, it->y, it->x_over_twist, it->y_over_twist});
+                for (auto dc = it->double_coefficients.cbegin(); dc != it->double_coefficients.cend(); dc++)
+                {
+                    elements.back().insert(elements.back().end(), {dc->c_h, dc->c_4c, dc->c_j, dc->c_l});
+                }
+                for (auto ac = it->addition_coefficients.cbegin(); ac != it->addition_coefficients.cend(); ac++)
+                {
+                    elements.back().insert(elements.back().end(), {ac->c_l1, ac->c_rz});
+                }
+            }
+            return elements;
+        });
+
+        std::vector<PrecomputedG2<F1, N>> g2_prepared;
+        for (auto table = tables.cbegin(); table != tables.cend(); table++)
+        {
+            auto const elements = (*table)->elements(context);
+            auto g2_p = PrecomputedG2<F1, N>{
+                elements[0],
+                elements[1],
+                elements[2],
+                elements[3],
+                std::vector<AteDoubleCoefficients<F1, N>>(),
+                std::vector<AteAdditionCoefficients<F1, N>>(),
+            };
+
+            // Doubling coefficients come first, one for every bit after the MSB
+            auto at = elements.cbegin() + 4;
+            auto it = RevBitIterator(this->x);
+            it.before(); // skip 1
+            while (it.before())
+            {
+                g2_p.double_coefficients.push_back(AteDoubleCoefficients<F1, N>{at[0], at[1], at[2], at[3]});
+                at += 4;
+            }
+            for (; at != elements.cend(); at += 2)
+            {
+                g2_p.addition_coefficients.push_back(AteAdditionCoefficients<F1, N>{at[0], at[1]});
+            }
+            g2_prepared.push_back(g2_p);
+        }
+
+        return g2_prepared;
+    }
+
+    // Preparation of many points at once in affine coordinates, every step takes a single inversion
+    // for all of them. Coefficients are those of precompute_g2 divided by a factor from F1, which the
+    // final exponentiation removes. None if some step would divide by zero.
+    template <class C>
+    Option<std::vector<PrecomputedG2<F1, N>>> precompute_g2_affine(std::vector<CurvePoint<F1>> const &g2_points, F1 const &twist_inv, C const &context) const
+    {
+        auto const one = F1::one(context);
+        std::vector<PrecomputedG2<F1, N>> g2_ps;
+        std::vector<F1> rx, ry;
+        for (auto it = g2_points.cbegin(); it != g2_points.cend(); it++)
+        {
+            auto x_over_twist = it->x;
+            x_over_twist.mul(twist_inv);
+            auto y_over_twist = it->y;
+            y_over_twist.mul(twist_inv);
+
+            g2_ps.push_back(PrecomputedG2<F1, N>{
+                it->x,
+                it->y,
+                x_over_twist,
+                y_over_twist,
+                std::vector<AteDoubleCoefficients<F1, N>>(),
+                std::vector<AteAdditionCoefficients<F1, N>>(),
+            });
+            rx.push_back(it->x);
+            ry.push_back(it->y);
+        }
+
+        std::vector<F1> denominators;
+        auto it = RevBitIterator(this->x);
+        it.before(); // skip 1
+        while (it.before())
+        {
+            // Doubling, lambda = (3x^2 + a) / 2y
+            denominators = ry;
+            for (auto d = denominators.begin(); d != denominators.end(); d++)
+            {
+                d->mul2();
+            }
+            if (!batch_inverse(denominators))
+            {
+                return {};
+            }
+
+            for (usize i = 0; i < g2_ps.size(); i++)
+            {
+                auto lambda = rx[i];
+                lambda.square();
+                auto const x2 = lambda;
+                lambda.mul2();
+                lambda.add(x2);
+                lambda.add(this->curve_twist.get_a());
+                lambda.mul(denominators[i]);
+
+                auto c_l = lambda;
+                c_l.mul(rx[i]);
+                g2_ps[i].double_coefficients.push_back(AteDoubleCoefficients<F1, N>{one, ry[i], lambda, c_l});
+
+                affine_step(lambda, rx[i], rx[i], ry[i]);
+            }
+
+            if (*it)
+            {
+                // Addition of the point, lambda = (y - Y) / (x - X)
+                for (usize i = 0; i < g2_ps.size(); i++)
+                {
+                    denominators[i] = g2_points[i].x;
+                    denominators[i].sub(rx[i]);
+                }
+                if (!batch_inverse(denominators))
+                {
+                    return {};
+                }
+
+                for (usize i = 0; i < g2_ps.size(); i++)
+                {
+                    auto lambda = g2_points[i].y;
+                    lambda.sub(ry[i]);
+                    lambda.mul(denominators[i]);
+
+                    g2_ps[i].addition_coefficients.push_back(AteAdditionCoefficients<F1, N>{lambda, one});
+
+                    affine_step(lambda, g2_points[i].x, rx[i], ry[i]);
+                }
+            }
+        }
+
+        if (this->x_is_negative)
+        {
+            // Addition of -R gives a vertical line
+            for (auto g2_p = g2_ps.begin(); g2_p != g2_ps.end(); g2_p++)
+            {
+                g2_p->addition_coefficients.push_back(AteAdditionCoefficients<F1, N>{one, F1::zero(context)});
+            }
+        }
+
+        return g2_ps;
+    }
+
+    // (X, Y) becomes the third point on the line of slope lambda through (X, Y) and a point with x, negated.
+    void affine_step(F1 const &lambda, F1 const &x, F1 &rx, F1 &ry) const
+    {
+        // x3 = lambda^2 - X - x, y3 = lambda * (X - x3) - Y
+        auto x3 = lambda;
+        x3.square();
+        x3.sub(rx);
+        x3.sub(x);
+        auto y3 = rx;
+        y3.sub(x3);
+        y3.mul(lambda);
+        y3.sub(ry);
+
+        rx = x3;
+        ry = y3;
+    }
+
     AteDoubleCoefficients<F1, N> doubling_step(ExtendedCoordinates<F1, N> &r) const
     {
         auto a = r.t;
@@ -420,7 +630,7 @@ private:
     std::optional<F2> final_exponentiation(F2 const &f) const
     {
         auto const ovalue_inv = f.inverse();
-        if (ovalue_inv)
+        if (!ovalue_inv)
         {
             return {};
         }
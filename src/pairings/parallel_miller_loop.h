@@ -0,0 +1,39 @@
+#ifndef H_PARALLEL_MILLER_LOOP
+#define H_PARALLEL_MILLER_LOOP
+
+#include "../common.h"
+#include "../thread_pool.h"
+
+// Fewer pairs than this are not split between threads.
+static const usize MIN_MILLER_LOOP_PAIRS_PER_THREAD = 2;
+
+// Splits pairs with prepared G2 points into chunks over the thread pool, every chunk runs a Miller
+// loop of its own. Products of the chunks are multiplied, so a single final exponentiation is left.
+template <class F, class P, class L>
+F parallel_miller_loop(std::vector<P> const &pairs, L const &miller_loop)
+{
+    auto &pool = ThreadPool::global();
+    auto const n_chunks = max(usize(1), min(pool.threads(), pairs.size() / MIN_MILLER_LOOP_PAIRS_PER_THREAD));
+    if (n_chunks == 1)
+    {
+        return miller_loop(pairs);
+    }
+
+    std::vector<Option<F>> products(n_chunks);
+    pool.parallel_for(n_chunks, [&](usize chunk) {
+        auto const begin = chunk * pairs.size() / n_chunks;
+        auto const end = (chunk + 1) * pairs.size() / n_chunks;
+        std::vector<P> const chunk_pairs(pairs.cbegin() + begin, pairs.cbegin() + end);
+        products[chunk] = miller_loop(chunk_pairs);
+    });
+
+    auto f = products[0].value();
+    for (usize chunk = 1; chunk < n_chunks; chunk++)
+    {
+        f.mul(products[chunk].value());
+    }
+
+    return f;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef H_PREPARED_G2
+#define H_PREPARED_G2
+
+#include "../common.h"
+#include "../fixed_base.h"
+#include "../table_cache.h"
+#include <memory>
+
+// From this many points on G2 points are prepared together in affine coordinates,
+// so that every step takes a single inversion for all of them.
+static const usize MIN_AFFINE_PREPARE_POINTS = 10;
+
+// Line coefficients of a G2 point for the Miller loop, as a flat list of elements.
+// Only points that passed the subgroup check are prepared, so a cached point needs no check.
+template <class F>
+class PreparedG2Table : public CachedTable
+{
+    usize n_elements;
+    std::vector<u64> limbs;
+
+public:
+    PreparedG2Table(std::vector<F> const &elements) : n_elements(elements.size())
+    {
+        for (auto it = elements.cbegin(); it != elements.cend(); it++)
+        {
+            detach(*it, limbs);
+        }
+    }
+
+    usize memory() const override
+    {
+        return limbs.size() * sizeof(u64);
+    }
+
+    template <class C>
+    std::vector<F> elements(C const &context) const
+    {
+        std::vector<F> elements;
+        if (n_elements == 0)
+        {
+            return elements;
+        }
+
+        auto const element_limbs = limbs.size() / n_elements;
+        for (usize i = 0; i < n_elements; i++)
+        {
+            elements.push_back(attach(limbs.data() + i * element_limbs, context));
+        }
+
+        return elements;
+    }
+};
+
+// Tables of the G2 points with keys. Points not in the cache yet are passed to prepare by their
+// indexes all at once, it returns the elements of their tables in the same order.
+template <class F, class P>
+std::vector<std::shared_ptr<PreparedG2Table<F> const>> prepared_g2_tables(std::vector<std::string> const &keys, P const &prepare)
+{
+    auto &cache = TableCache::prepared_g2();
+    std::vector<std::shared_ptr<PreparedG2Table<F> const>> tables;
+    std::vector<usize> missing;
+    for (usize i = 0; i < keys.size(); i++)
+    {
+        tables.push_back(std::dynamic_pointer_cast<PreparedG2Table<F> const>(cache.get(keys[i])));
+        if (!tables.back())
+        {
+            missing.push_back(i);
+        }
+    }
+
+    if (missing.empty())
+    {
+        return tables;
+    }
+
+    std::vector<std::vector<F>> const elements = prepare(missing);
+    for (usize k = 0; k < missing.size(); k++)
+    {
+        auto const i = missing[k];
+        tables[i] = std::make_shared<PreparedG2Table<F> const>(elements[k]);
+        cache.insert(keys[i], tables[i]);
+    }
+
+    return tables;
+}
+
+#endif
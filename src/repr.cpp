@@ -74,7 +74,7 @@ bool is_odd(std::vector<u64> const &repr)
 
 void div2(std::vector<u64> &repr)
 {
-    auto t = 0;
+    u64 t = 0;
     for (auto it = repr.rbegin(); it != repr.rend(); it++)
     {
         auto const t2 = *it << 63;
@@ -194,15 +194,16 @@ u32 num_bits(std::vector<u64> const &repr)
 
 void add_scalar(std::vector<u64> &repr, u64 value)
 {
-    for (usize i = 0; value > 0; i++)
+    u64 carry = value;
+    for (usize i = 0; carry > 0; i++)
     {
         if (i >= repr.size())
         {
-            repr.push_back(value);
+            repr.push_back(carry);
             break;
         }
 
-        repr[i] = adc(repr[i], value, value);
+        repr[i] = adc(repr[i], 0, carry);
     }
 }
 
@@ -219,6 +220,87 @@ void mul_scalar(std::vector<u64> &repr, const u64 scalar)
     }
 }
 
+void add_nocarry(std::vector<u64> &a, std::vector<u64> const &b)
+{
+    a.resize(max(a.size(), b.size()), 0);
+
+    u64 carry = 0;
+    for (usize i = 0; i < a.size(); i++)
+    {
+        a[i] = adc(a[i], i < b.size() ? b[i] : 0, carry);
+    }
+    if (carry > 0)
+    {
+        a.push_back(carry);
+    }
+}
+
+bool equal(std::vector<u64> const &a, std::vector<u64> const &b)
+{
+    return greater_or_equal(a, b) && greater_or_equal(b, a);
+}
+
+void sub_noborrow(std::vector<u64> &a, std::vector<u64> const &b)
+{
+    u64 borrow = 0;
+    for (usize i = 0; i < a.size(); i++)
+    {
+        a[i] = sbb(a[i], i < b.size() ? b[i] : 0, borrow);
+    }
+}
+
+std::vector<u64> multiply(std::vector<u64> const &a, std::vector<u64> const &b)
+{
+    std::vector<u64> res(a.size() + b.size(), 0);
+    for (usize i = 0; i < a.size(); i++)
+    {
+        u64 carry = 0;
+        for (usize j = 0; j < b.size(); j++)
+        {
+            // a[i] * b[j] + res[i + j] + carry fits into two limbs
+            auto const lo = mul_with_carry(a[i], b[j], carry);
+            u64 add_carry = 0;
+            res[i + j] = adc(res[i + j], lo, add_carry);
+            carry += add_carry;
+        }
+        res[i + b.size()] = carry;
+    }
+
+    return res;
+}
+
+std::vector<u64> div_rem(std::vector<u64> &a, std::vector<u64> const &b)
+{
+    assert(!is_zero(b));
+
+    // Binary long division, remainder is kept one limb longer than the divisor
+    std::vector<u64> quotient(max(a.size(), usize(1)), 0);
+    std::vector<u64> remainder(b.size() + 1, 0);
+
+    for (auto i = num_bits(a); i > 0; i--)
+    {
+        auto const bit = (a[(i - 1) / LIMB_BITS] >> ((i - 1) % LIMB_BITS)) & 1;
+
+        // remainder = 2 * remainder + bit
+        for (auto j = remainder.size() - 1; j > 0; j--)
+        {
+            remainder[j] = (remainder[j] << 1) | (remainder[j - 1] >> 63);
+        }
+        remainder[0] = (remainder[0] << 1) | bit;
+
+        if (greater_or_equal(remainder, b))
+        {
+            sub_noborrow(remainder, b);
+            quotient[(i - 1) / LIMB_BITS] |= u64(1) << ((i - 1) % LIMB_BITS);
+        }
+    }
+
+    remainder.resize(max(a.size(), usize(1)), 0);
+    a = remainder;
+
+    return quotient;
+}
+
 void right_shift(std::vector<u64> &repr, u64 shift)
 {
     auto const num_libs = repr.size();
@@ -234,6 +316,24 @@ void right_shift(std::vector<u64> &repr, u64 shift)
     repr[num_libs - 1] = repr[num_libs - 1] >> shift;
 }
 
+u64 get_bits(std::vector<u64> const &repr, usize offset, u32 width)
+{
+    auto const limb = offset / LIMB_BITS;
+    auto const shift = offset % LIMB_BITS;
+    if (limb >= repr.size())
+    {
+        return 0;
+    }
+
+    auto bits = repr[limb] >> shift;
+    if (shift + width > LIMB_BITS && limb + 1 < repr.size())
+    {
+        bits |= repr[limb + 1] << (LIMB_BITS - shift);
+    }
+
+    return bits & ((u64(1) << width) - 1);
+}
+
 std::vector<i64> into_ternary_wnaf(std::vector<u64> const &repr)
 {
     std::vector<i64> res;
@@ -243,7 +343,9 @@ std::vector<i64> into_ternary_wnaf(std::vector<u64> const &repr)
         return res;
     }
 
+    // Extra limb, as adding a negative digit back may carry out of the top one
     std::vector<u64> e = repr;
+    e.push_back(0);
 
     constexpr u64 WINDOW = u64(1);
     constexpr u64 MIDPOINT = u64(1) << WINDOW;
@@ -272,6 +374,61 @@ std::vector<i64> into_ternary_wnaf(std::vector<u64> const &repr)
     return res;
 }
 
+std::vector<i64> into_wnaf(std::vector<u64> const &repr, u32 window)
+{
+    std::vector<i64> res;
+
+    // Extra limb, as adding a negative digit back may carry out of the top one
+    std::vector<u64> e = repr;
+    e.push_back(0);
+
+    u64 const mask = (u64(1) << window) - 1;
+    i64 const half = i64(1) << (window - 1);
+    while (!is_zero(e))
+    {
+        i64 z = 0;
+        if (is_odd(e))
+        {
+            z = i64(e[0] & mask);
+            if (z >= half)
+            {
+                z -= half << 1;
+                add_nocarry(e, u64(-z));
+            }
+            else
+            {
+                sub_noborrow(e, u64(z));
+            }
+        }
+        res.push_back(z);
+        div2(e);
+    }
+
+    return res;
+}
+
+std::vector<i64> into_signed_windows(std::vector<u64> const &repr, u32 width)
+{
+    std::vector<i64> res;
+
+    i64 const half = i64(1) << (width - 1);
+    auto const bits = num_bits(repr);
+    i64 carry = 0;
+    for (usize offset = 0; offset < bits || carry != 0; offset += width)
+    {
+        auto digit = i64(get_bits(repr, offset, width)) + carry;
+        carry = 0;
+        if (digit > half)
+        {
+            digit -= half << 1;
+            carry = 1;
+        }
+        res.push_back(digit);
+    }
+
+    return res;
+}
+
 u32 calculate_hamming_weight(std::vector<u64> const &repr)
 {
     auto weight = 0;
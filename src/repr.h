@@ -76,10 +76,38 @@ u32 num_bits(std::vector<u64> const &repr);
 
 void mul_scalar(std::vector<u64> &repr, u64 scalar);
 
+// a += b
+// a grows to hold the result
+void add_nocarry(std::vector<u64> &a, std::vector<u64> const &b);
+
+// a == b
+// Where a and b are numbers
+bool equal(std::vector<u64> const &a, std::vector<u64> const &b);
+
+// a -= b
+// Where a >= b
+void sub_noborrow(std::vector<u64> &a, std::vector<u64> const &b);
+
+// a * b
+std::vector<u64> multiply(std::vector<u64> const &a, std::vector<u64> const &b);
+
+// Divides a by b, leaves the remainder in a and returns the quotient.
+// b must not be zero.
+std::vector<u64> div_rem(std::vector<u64> &a, std::vector<u64> const &b);
+
 void right_shift(std::vector<u64> &repr, u64 shift);
 
+// Bits [offset, offset + width) of repr, for width < 64
+u64 get_bits(std::vector<u64> const &repr, usize offset, u32 width);
+
 std::vector<i64> into_ternary_wnaf(std::vector<u64> const &repr);
 
+// Width-w NAF: odd digits in (-2^(window-1), 2^(window-1)) followed by at least window-1 zeros, lowest first
+std::vector<i64> into_wnaf(std::vector<u64> const &repr, u32 window);
+
+// Signed digits d_i in [-2^(width-1), 2^(width-1)] with repr = sum of d_i * 2^(width*i), lowest first
+std::vector<i64> into_signed_windows(std::vector<u64> const &repr, u32 width);
+
 u32 calculate_hamming_weight(std::vector<u64> const &repr);
 
 // ********************** ITERATORS ******************* //
@@ -0,0 +1,127 @@
+#include "table_cache.h"
+
+TableCache &TableCache::fixed_bases()
+{
+    static TableCache cache(DEFAULT_FIXED_BASE_CACHE_BUDGET);
+
+    return cache;
+}
+
+TableCache &TableCache::base_sets()
+{
+    static TableCache cache(DEFAULT_BASE_SET_CACHE_BUDGET);
+
+    return cache;
+}
+
+TableCache &TableCache::prepared_g2()
+{
+    static TableCache cache(DEFAULT_PREPARED_G2_CACHE_BUDGET);
+
+    return cache;
+}
+
+usize TableCache::budget() const
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    return budget_;
+}
+
+void TableCache::set_budget(usize budget)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    budget_ = budget;
+    evict(budget_);
+}
+
+usize TableCache::memory() const
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    return memory_;
+}
+
+std::shared_ptr<CachedTable const> TableCache::get(std::string const &key)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto const found = index.find(key);
+    if (found == index.end())
+    {
+        return nullptr;
+    }
+
+    // Move to the front as most recently used
+    entries.splice(entries.begin(), entries, found->second);
+
+    return std::get<1>(*found->second);
+}
+
+bool TableCache::count_use(std::string const &key)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (budget_ == 0)
+    {
+        return false;
+    }
+
+    if (uses.size() >= MAX_COUNTED_FIXED_BASES && uses.find(key) == uses.end())
+    {
+        uses.clear();
+    }
+
+    auto &n = uses[key];
+    n++;
+    if (n < MIN_FIXED_BASE_USES)
+    {
+        return false;
+    }
+
+    uses.erase(key);
+    return true;
+}
+
+void TableCache::insert(std::string const &key, std::shared_ptr<CachedTable const> table)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto const memory = table->memory();
+    if (memory > budget_ || index.find(key) != index.end())
+    {
+        return;
+    }
+
+    evict(budget_ - memory);
+    entries.push_front(std::tuple(key, table));
+    index[key] = entries.begin();
+    memory_ += memory;
+}
+
+bool TableCache::insert_if_fits(std::string const &key, std::shared_ptr<CachedTable const> table)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (index.find(key) != index.end())
+    {
+        return true;
+    }
+
+    auto const memory = table->memory();
+    if (memory_ + memory > budget_)
+    {
+        return false;
+    }
+
+    entries.push_front(std::tuple(key, table));
+    index[key] = entries.begin();
+    memory_ += memory;
+
+    return true;
+}
+
+void TableCache::evict(usize budget)
+{
+    while (memory_ > budget)
+    {
+        auto const &last = entries.back();
+        memory_ -= std::get<1>(last)->memory();
+        index.erase(std::get<0>(last));
+        entries.pop_back();
+    }
+}
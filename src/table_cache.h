@@ -0,0 +1,81 @@
+#ifndef H_TABLE_CACHE
+#define H_TABLE_CACHE
+
+#include "common.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Fixed base tables are kept until they take more than this many bytes.
+static const usize DEFAULT_FIXED_BASE_CACHE_BUDGET = usize(16) << 20;
+
+// A base gets its table once it was multiplied this many times.
+static const usize MIN_FIXED_BASE_USES = 4;
+
+// Limits how many not yet tabled bases are counted.
+static const usize MAX_COUNTED_FIXED_BASES = 1024;
+
+// Cap on memory of registered multiexp base sets.
+static const usize DEFAULT_BASE_SET_CACHE_BUDGET = usize(64) << 20;
+
+// Line coefficients of pairing G2 points are kept until they take more than this many bytes.
+static const usize DEFAULT_PREPARED_G2_CACHE_BUDGET = usize(16) << 20;
+
+// Precomputation that outlives a call, so it holds no references to field contexts.
+class CachedTable
+{
+public:
+    virtual ~CachedTable() {}
+
+    // Bytes taken by the table.
+    virtual usize memory() const = 0;
+};
+
+// Tables keyed by the input bytes they were computed from.
+// Least recently used tables are evicted to stay within the memory budget.
+class TableCache
+{
+    typedef std::list<std::tuple<std::string, std::shared_ptr<CachedTable const>>> Entries;
+
+    usize budget_;
+    usize memory_;
+    Entries entries;
+    std::unordered_map<std::string, Entries::iterator> index;
+    std::unordered_map<std::string, usize> uses;
+    mutable std::mutex mutex;
+
+    void evict(usize budget);
+
+public:
+    TableCache(usize budget) : budget_(budget), memory_(0) {}
+
+    // Cache of tables for fixed base multiplication.
+    static TableCache &fixed_bases();
+
+    // Cache of registered multiexp base sets.
+    static TableCache &base_sets();
+
+    // Cache of line coefficients of pairing G2 points.
+    static TableCache &prepared_g2();
+
+    usize budget() const;
+
+    // Budget of 0 disables the cache.
+    void set_budget(usize budget);
+
+    usize memory() const;
+
+    std::shared_ptr<CachedTable const> get(std::string const &key);
+
+    // Counts a use of key, returns true if a table should be made for it.
+    bool count_use(std::string const &key);
+
+    // Tables larger than the budget are not kept.
+    void insert(std::string const &key, std::shared_ptr<CachedTable const> table);
+
+    // Keeps the table only if it fits without evicting others.
+    bool insert_if_fits(std::string const &key, std::shared_ptr<CachedTable const> table);
+};
+
+#endif
@@ -163,6 +163,222 @@ void tests()
     //     auto const output = parse_hex("7ccf8ead202f00683db10087c511a2d6d43aa1fe8efa5de19e86368b13d77969e370abf3a4a8cd876410835eb0def110a0aabfc237af1fee6bbce8ea171e31ce154e1b0554471189638918c98eec3b645f52092aeea6aa97da5dc5e06a04c9daff33e3622a8de62d55c1bafa3ba165899fc1455fba91c34e3440f44dbacd555e2860e3cf07138bbf63ab5c9796de21913e36f2aac71e38d19e82978f43420dc4");
     //     api_test(input, output, "G2 multiplication: 3");
     // }
+    {
+        auto const input = parse_hex("05301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab021a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000040000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000010cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d52a327b6983fd97359af6769e486737d8ff4ef93d2253c87a51b453f0e5e928c");
+        auto const output = parse_hex("039455b8d7c070fa86a8c2a27dbafa3f8a717138742a85e149e19cbffd000283bcfbe230c843c5559a4dc8f6c121dc4d06b565fc5ecf74a84edb3fbba3451e5dde20a82b5d8f99300dcf8005bec9631ea3c6f5d49e2618f47f38f64aa88db21203fb9b11a601df1026a4e24b39fee428d215ba9c94c0a3fb6eddfc41e81acbf020b21cffedd89619494aa7f9b4bd50130be5d52142c1403d399b9d90e62266bab95ced4b70936da7c95f6aebf912b74e151c3c83277a6f90de92dd09221fe6de");
+        api_test(input, output, "G2 multiplication: BLS12-381 endomorphism");
+    }
+    {
+        auto const input = parse_hex("06301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab021a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000040000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001030cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d0554c4da07e7166b075b058bb363af43244fbafcfa376a6e5848fc64296c764d0cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d19830fde5d082eeac3034515972939b0db43738610d5fe140bf3d0a7bc9df599161cd52de21342b0f1eedba313432e611ca3c4480279b6a68f9797b06d7ce3c9b4a69f3c8d3aed99711c21c9bdc14f1f0156a97b20a045026e06809725e979778d7248e2951f58d05e84f058d5a804eb093923de8babce3b26286bfbe767dcea170cc9cb04bd98140dc58c7f4eec79ec4bf46411cbf69e264ff13b1474664b93690e02ccc33d901a4d0bdc94f8b1eea019f21534a067de3e4446ae1abdab8cb30481922cae6c761a709966f3347ba086c4d2ab8e6e959a837f10a6bebbff1e893121c1b1f1bf55edb6143f78ea16b18fc17a4f81de27a24ee134f9f810e1fec9");
+        auto const output = parse_hex("16537e403ed09c1c616b61acbeca16dff8385d1e622a9130698a1d9c9fa6a21b07e304cc010466b74a54bdae03a8f575072651ddd85cf74b846350a2070f181c815488cb63e979626b9f2a23a0afcc711bf5dc563bc05eb274222b5b0e6ba359118b07d48e8b75ff569a41361c8435a9312cfe5613292cb411717c2ddfbc34a76c02061e79a4ed21ce3a6d8790370630045db5235aef29a9beaef123d3f099e105b5037e9e72de31e61bda6fd1e57dbf31d05a2338eab9a98fd953c89291d635");
+        api_test(input, output, "G2 multiexp: BLS12-381 3 pairs");
+    }
+    {
+        auto const input = parse_hex("07022030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f000000130644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd4600000000000000000000000000000000000000000000000000000000000000090000000000000000000000000000000000000000000000000000000000000001020844e992b44a6909f100022fe56ba254b2d140801a035e0d623d1d287204f7d819d303c5e4d14731c92fe00122ee67a020d48c23d59273d226a8c348726ec367b3636846892a42bb500b540493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b08ee307a392456de3eb13b9046685257bdd640fb06671ad11c80317fa3b1799d01f20ce266e9b4f8af9c10d0e7dced97d202645096d001cf3250c37a4ad5098c01a7cb2bca96790c2d6c7c3fb2a4c4ecd17cafc4729de3b288a682950a157c020e8cadaaec00a0128eb368f446c5ad4c4bd0fb8069cf15d636214e6f2ebc59010068a6344fba24095fc954c781630ccc02b36e82f77c1d293f5e9253ca8f156726e902f931017dbd61a9d1bc4b065a6c85f73a2800fc8e255f08369541cc7a4c");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: BN254 bilinearity");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d201000000010000010103e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e161cd52de21342b0f1eedba313432e611ca3c4480279b6a68f9797b06d7ce3c9b4a69f3c8d3aed99711c21c9bdc14f1f0156a97b20a045026e06809725e979778d7248e2951f58d05e84f058d5a804eb093923de8babce3b26286bfbe767dcea170cc9cb04bd98140dc58c7f4eec79ec4bf46411cbf69e264ff13b1474664b93690e02ccc33d901a4d0bdc94f8b1eea019f21534a067de3e4446ae1abdab8cb30481922cae6c761a709966f3347ba086c4d2ab8e6e959a837f10a6bebbff1e89");
+        api_test(input, {}, "Pairing: BLS12-381 G2 point out of subgroup");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d20100000001000000080eb374a4ecc326b88597ebbfd9f7e0e46c14fb8f0cf298634dbf17cedcff000f9ddedf0131e276e233ed12af642783cd13600602e5bec5f08451d91c215b0dfca7c9d73aab806273ee3a5469edd0e29782c82f1418bfad8755ba4262726e13920cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d03e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a751514619e941c078868b9f1b2327e5cfa051189d0337838d28ca22f17d2a74418a307ed1085cdb38c5ea69bea1b8065fe0d133452db6b1d5da39298f80f26fc2a86f20ecaa8a947ac60aa179d25153e1048a3e58bb35df66804ea2ebcc1f2cece8912bea2061e1ee292e5b039081355cbc6a69c7b0bef9ef61b054277c7ded98472b08a88d04a5c0660a08f264cb2d237ab0678cefe28f3345f880f78c5c3869b94cc17ee0e7e701f93c59bf0e2f1308cb6d74401d9f27595b0b83636e2e6d2d6c8092477a161b873e044811d64c5e43a00773aa00e541ba3d76a6973830c8b6ad79d8bf0c61b884aba845dfc20b76f830d18af1dddb1f2ef4648372d74f5b4d49c8e99fe4f5680fa1e9e2e13ade557028beee3c999dd7e60bb76fa95232e9317940036a639796cccd36f2813d73e257213d114ab1b89caadaeb34822b298b9cf8f9084a84ba16f14e71122a0b52e5da2eb155098d36c96eecfba971623862850850467643cb3fdb41287c9b71e0d5e44aca284b8e9289294cd41bf0c0bd1f313fc0e2dabb9cd38e74bcf341e739a18282b2ccf1c08f92a0d3e0b20ccf27cf6a07a6a25b07ebfde197076167024ecdd4ba5189111603236b9d3f5e6e43cf719df1a5a6a9e3ca0aff8989f476fa65b0ed6d4ec33326093a20af8ea6aa08da9686ef319e21b8f3e32b0f2d479ff1d6aa41ccddb57bc23221e0ae0e6a380dbe83c25d1095d9d0082a51692ab93a4b4a0b2dee30abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b5593071032d24501a5ef16d7f674669c02ff25a73d7595117d37fa8e83f3ff7ca665c457b3c63815b0d0b7ca4deba93171b419ca268772606b7b6bdfe6279aa5b114f161ef1e881ef27cd21293ecca04027b610c6506426cfed90c2569080be4df5c0ce1784a63a52cecfdcfe6c69eeebdffa4f6328046d4cf17a1a89323ad1f30bed0373fbb36fb713787c78952e6c54ad2082df705148d4540e5bacccdc1f03a66118a18ba543e0ee67f1a13fe51907448d41210937ac01fcaf70a3410c7abbbfa109755caa5b0367b498ac9445972588f76d519cad20e0ff787fdc4061924a3778ca2e9c267d72964fc14d61fc03e954113961cfd7d71cd15f72df1988666215f1561b34f18d873418ee69eb17e248bda94c12e2147467056985aebec50dbe35c18be70b65364568a3ea9f5751819ee9211d9684b584e971ab4eb63972284f006ff3526be904f8f6795a71f097ac0ff88083b9b1d3840f51c660d3f1aa28a4aec602ac1ec65b800dcdd92d1b49a04becfb4d53fd6e66a76282df6071f87c42a6e08c51751c223078d41e837be6b95d19d92a4408caad9f063361dbc0143a2f7ba752f29b8bebb94e62ec2c8eada03d9ab0b2b093835a315ad3d4c064a6d8e76eb8faa17ebfd561dece7eac846869dc096d5a4cfd0603d9c876044c97fea6e850f0b820a19cdb3c38f0078ea902950a6e9a4a8fb0bafc5a285fbfeb6457e39f84da8f1ca01949ce3f444c66c9143722f8406807b0731872ede848d7d028058d835973fc267dbfc94e699358ac8b6d0e7feb44c295ea0aa4509787df74dd5024a1c0a5ec8bcb7545796021db6d07aa2093977fd501c43ec6a84ce7503f9fd39c5186a3d35aac06b31b4fbc12c6e8e3b4e830056e485a7ae6d6ef62f77080e6906dcbc724ca494a85ec0f3eda108a667b15d8df9e9e51aef859483307798d31b23010f4857f96a23de16c713bb74d0aeb7dcfb73951f73abeb44ac3efbe32fd779c85b6507a7cc0160b8db48870d8de086f708c776d466249c02383a0151e4db798a35ad3301329d71745257a64c90de3018288fd919bfa1e700ebde6abd39ef436d0202571135cba8fc9540127001010dda27368601cc496b9a3ce919c7221c629ae38050258ca6be8994aff5398c2904ed123f76aaf9924b2b92bc375b1940f9f82c75cf349cdfadb58c91fd80bb3466e131f73eafbfa99d4c3edc8694585870181204396eb865310ac69d857f681d3c462a37e90d7f3f4438df6e03dd940ddb64ae69b7cd1f43e1a762895cef9c34f7f3114530addcc9dc35e396fba9095c11d33489141fe6ae9f737e9bbe82aafb6ce685ac61d3f52fa1bee1e6bfa2962354d512b67986e87466a5150a753c69d8dfd0df669fb6dd00032b6f2690df0db953b3b7980ac01b1e36497d9d01464531f34f0d5adbaa611d1e3ad52673c020f0b862352293db62cb473b49a651fcd5b6317c288af9415efd8fbf1e6718b3f72e0fa713d31fd2342f8b7f30b555e8db0bd095c18803d6fd04048c33bea9b9663b958e6b395c728326a431a22f38b9424e28020ec6ad0f79af3e8eb52de0df3987f0402ed589c56161b32beff32804e65f888d6dbc643e9f3a2efc62f0db113988f3f4097808e27154aafeadb424d51c35ad61ae04092509e565e14825f6d9d0e350db9d79ecc71c65b90f0cf26f1f36a5f0ab0919746704c4c92d39d60d124f865a5c1755bfed4162d3b506aab66df6333ae5d398658ec2d28eadf9aa1a80dac5fb4006707f8b2756ff81b991fef24947d8e36564222ab70e6904c5226db9d74f30b4d48084a4d2dafac10cfb4504f7b3c0d0055e7ad956324649ddf0cb495d33a1dac22422ecbf1c012ac123146922f7946fad04c25759b01285ccbf405d8fd1613d1162030c55041a37a7823207d1f4b749f090ce408c583c12e63815275accaf93cb4e824cc5f4011a5d823170ec034209");
+        auto const output = parse_hex("00");
+        api_test(input, output, "Pairing: 8 pairs outside of BLS12 family");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d20100000001000000080eb374a4ecc326b88597ebbfd9f7e0e46c14fb8f0cf298634dbf17cedcff000f9ddedf0131e276e233ed12af642783cd13600602e5bec5f08451d91c215b0dfca7c9d73aab806273ee3a5469edd0e29782c82f1418bfad8755ba4262726e13920cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d03e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a751514619e941c078868b9f1b2327e5cfa051189d0337838d28ca22f17d2a74418a307ed1085cdb38c5ea69bea1b8065fe0d133452db6b1d5da39298f80f26fc2a86f20ecaa8a947ac60aa179d25153e1048a3e58bb35df66804ea2ebcc1f2cece8912bea2061e1ee292e5b039081355cbc6a69c7b0bef9ef61b054277c7ded98472b08a88d04a5c0660a08f264cb2d237ab0678cefe28f3345f880f78c5c3869b94cc17ee0e7e701f93c59bf0e2f1308cb6d74401d9f27595b0b83636e2e6d2d6c8092477a161b873e044811d64c5e43a00773aa00e541ba3d76a6973830c8b6ad79d8bf0c61b884aba845dfc20b76f830d18af1dddb1f2ef4648372d74f5b4d49c8e99fe4f5680fa1e9e2e13ade557028beee3c999dd7e60bb76fa95232e9317940036a639796cccd36f2813d73e257213d114ab1b89caadaeb34822b298b9cf8f9084a84ba16f14e71122a0b52e5da2eb155098d36c96eecfba971623862850850467643cb3fdb41287c9b71e0d5e44aca284b8e9289294cd41bf0c0bd1f313fc0e2dabb9cd38e74bcf341e739a18282b2ccf1c08f92a0d3e0b20ccf27cf6a07a6a25b07ebfde197076167024ecdd4ba5189111603236b9d3f5e6e43cf719df1a5a6a9e3ca0aff8989f476fa65b0ed6d4ec33326093a20af8ea6aa08da9686ef319e21b8f3e32b0f2d479ff1d6aa41ccddb57bc23221e0ae0e6a380dbe83c25d1095d9d0082a51692ab93a4b4a0b2dee30a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec131319ca268772606b7b6bdfe6279aa5b114f161ef1e881ef27cd21293ecca04027b610c6506426cfed90c2569080be4df5c0ce1784a63a52cecfdcfe6c69eeebdffa4f6328046d4cf17a1a89323ad1f30bed0373fbb36fb713787c78952e6c54ad2082df705148d4540e5bacccdc1f03a66118a18ba543e0ee67f1a13fe51907448d41210937ac01fcaf70a3410c7abbbfa109755caa5b0367b498ac9445972588f76d519cad20e0ff787fdc4061924a3778ca2e9c267d72964fc14d61fc03e954113961cfd7d71cd15f72df1988666215f1561b34f18d873418ee69eb17e248bda94c12e2147467056985aebec50dbe35c18be70b65364568a3ea9f5751819ee9211d9684b584e971ab4eb63972284f006ff3526be904f8f6795a71f097ac0ff88083b9b1d3840f51c660d3f1aa28a4aec602ac1ec65b800dcdd92d1b49a04becfb4d53fd6e66a76282df6071f87c42a6e08c51751c223078d41e837be6b95d19d92a4408caad9f063361dbc0143a2f7ba752f29b8bebb94e62ec2c8eada03d9ab0b2b093835a315ad3d4c064a6d8e76eb8faa17ebfd561dece7eac846869dc096d5a4cfd0603d9c876044c97fea6e850f0b820a19cdb3c38f0078ea902950a6e9a4a8fb0bafc5a285fbfeb6457e39f84da8f1ca01949ce3f444c66c9143722f8406807b0731872ede848d7d028058d835973fc267dbfc94e699358ac8b6d0e7feb44c295ea0aa4509787df74dd5024a1c0a5ec8bcb7545796021db6d07aa2093977fd501c43ec6a84ce7503f9fd39c5186a3d35aac06b31b4fbc12c6e8e3b4e830056e485a7ae6d6ef62f77080e6906dcbc724ca494a85ec0f3eda108a667b15d8df9e9e51aef859483307798d31b23010f4857f96a23de16c713bb74d0aeb7dcfb73951f73abeb44ac3efbe32fd779c85b6507a7cc0160b8db48870d8de086f708c776d466249c02383a0151e4db798a35ad3301329d71745257a64c90de3018288fd919bfa1e700ebde6abd39ef436d0202571135cba8fc9540127001010dda27368601cc496b9a3ce919c7221c629ae38050258ca6be8994aff5398c2904ed123f76aaf9924b2b92bc375b1940f9f82c75cf349cdfadb58c91fd80bb3466e131f73eafbfa99d4c3edc8694585870181204396eb865310ac69d857f681d3c462a37e90d7f3f4438df6e03dd940ddb64ae69b7cd1f43e1a762895cef9c34f7f3114530addcc9dc35e396fba9095c11d33489141fe6ae9f737e9bbe82aafb6ce685ac61d3f52fa1bee1e6bfa2962354d512b67986e87466a5150a753c69d8dfd0df669fb6dd00032b6f2690df0db953b3b7980ac01b1e36497d9d01464531f34f0d5adbaa611d1e3ad52673c020f0b862352293db62cb473b49a651fcd5b6317c288af9415efd8fbf1e6718b3f72e0fa713d31fd2342f8b7f30b555e8db0bd095c18803d6fd04048c33bea9b9663b958e6b395c728326a431a22f38b9424e28020ec6ad0f79af3e8eb52de0df3987f0402ed589c56161b32beff32804e65f888d6dbc643e9f3a2efc62f0db113988f3f4097808e27154aafeadb424d51c35ad61ae04092509e565e14825f6d9d0e350db9d79ecc71c65b90f0cf26f1f36a5f0ab0919746704c4c92d39d60d124f865a5c1755bfed4162d3b506aab66df6333ae5d398658ec2d28eadf9aa1a80dac5fb4006707f8b2756ff81b991fef24947d8e36564222ab70e6904c5226db9d74f30b4d48084a4d2dafac10cfb4504f7b3c0d0055e7ad956324649ddf0cb495d33a1dac22422ecbf1c012ac123146922f7946fad04c25759b01285ccbf405d8fd1613d1162030c55041a37a7823207d1f4b749f090ce408c583c12e63815275accaf93cb4e824cc5f4011a5d823170ec034209");
+        api_test(input, {}, "Pairing: 8 pairs outside of BLS12 family, G1 point out of subgroup");
+    }
+    {
+        auto const input = parse_hex("032030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000011025caa11a16419f828b9d2434e465e150bd9c66b3ad3c2d6d1a3d1fa7bc8960a900c34dc01d6b8ab3a4624b5723271e608448fc938572a69526d88ee157898a3a106e6801f13c1af744e781d13ef23739f7afb126b280df83b03ad2438d805970076f571969b534cae96d326b5fb23767694a6617df24832191c2f5ae60458986248228d7c9ef2ea73edef383224b14c113bad417adaccef08d7af427e432586a25f737ff065a52056eaf3f1d6fbf1b3860008e241ca8871c20fb6b84824a13eb21673092d11c88378a859d7f3af3f120a8888fd61a8249812d76ecb7902e7ecc1b910fd35cf475c429c3941a3337c4cda624166ed05ab968f2a8d83d9a853fa615db36821788bf363496d2f8454bf5b71c776a1e341c1667c81d0e18ed99280813a8bcffa0084eb3d59ff585a3f3efd7aa820d4aa2fc86faf5a634c0d58e4b630335ef58bf4103261269acf8263f72a9b79f5b28e106917f13d1d7389c6eec47240968f8818dd8410bab35fbeaf590d18852c9db3fdaf1376a8e5c4cfd3641be15abe690ab1098c55701db609a7eb252d35a0c581fee5d79862dc331cd82ffeb1138cd1e817ba37a88a1015b04f560a2cc336054afc86b52f1f74c28f7b8bea31c08c30118786ff2ff41a575bb96167b528bc8a33b1b140e51d56fa26dbfb2ad08c3dd7af5b93c2b8dbd25d28c0ebe09b7e98ab97d9bc4823373f99216b85af824648c2d8a7fd386947459b512eed2e814c155f53a561ce22a7c13f8ff0160c614393c0e706cb853297943246b17ea034cd412e9249c6913544a49b842b77c010c05b8a015795c00ddf66fc4ab462d509a627fd670097e1149a2745f34ec191a159e73e71d253b9be6e0b5045482b60837220a07f5e264d4a015723162b0a5940ecb29ac09d108c9c528603f3ab9e8c06dbc6eaa5a420061795dfefeb10d530b282c4fb1bb0cfde0197c021b95ba26b2fccca06a13ba343a1d740260e85bf3270d4e73e082db4ebf9af9d38f10355d6c6569337f725e48ed9bae52d98066d158233cc261be2c3b10f81a96dd13727a51d919daf14456f4574546eda786a9e93a194c68aa91d38459be5b9c7f94c63577e2610376fdd0d6685c32310bcbc57fbb014ff851457778fe247b26fe46ac14ca48e65ae5b6aade07a3b3b362fb0ace490bfb9aa60472acdf016a47f3c34666c792b9d4cbd606902ca542281611bfec8c2701787726d2436d2955e5550ec82007388e0a3cbaf7276f26278d0e76d0254513e48876419890e8e82986f63fc1d3a91adca1b2e254bc09a21810577a66120e0dba6d146fea5e0705372d974ad792470512c299b3c07420b507b285732f67482a9ccea7a7190768c59f993d56ed62a02fb0557e454fd5afc65fcd428622ac491738d0ad5386c0be036a324743cb0efab15960e868ea4c5517e8c7c0c4350ad91269778bacd6256aa8069042ab1bcbd4d19924a91d8f7ae6e7fc7940f592121a1db76d9e632254fe9132f030f87bacdf605cd83e06999541b02610e43db59e362980b9348ea2bbc35604edc0455dfa953e945478721f914ba010253d54a3282f27d4b561fc3570630ec7aafba6150c6ca04ad6f2af85d9f58b1365a3aade6aaf2f2e92632a808ad8d84f2e31dab363ca07e38cd9a88be8d256574715ee9a5371216c97f442a0f13ef3ff9ab981940ba5cabc7537356f2f654faf59d02e2638fe2947835c2102d6b9a61ff45573eb3c87c631c963fec6be3ad2eac6fc52b27b3d156cae2b40692ff1468efab180693f3c084798a97a83ae37de48bfaafe2c6a6b0e5ee3fd01efac6c464a030d7c704da4bdecc941897566482bec159651f3cdb31dd193cf0335bfd0b4387adb5c261ea3c16f910db74e8e202b90d79dd449e01f24edde2bfbf4f3e102177a10c83c371ac406cb650267a7f6ebcb0715845b36b100605d7f5cf44a3344db8a8853d1f43f8ee4a75ad59c9dcc2d866eeca2825b810da6681dfe07168f54e7d9169849e034dc83cbc80b08fb1cba37925710682d33231cb11995443a1f22404b8cd70a2a356f2189dc637feef577133411b137d4870b4e9c891957b12676612d6e7dc8b97571526a8b56ba4dcc420c576f37defd6f1732ff01109588dd294c161afc70182804e85057fc028d2b358c0de63d122e18");
+        auto const output = parse_hex("0406ca776c8cac70936aa92ec7ab9f8c4e0748af8f8bf82454e2516c6230aeca01f2401740a27d310b17a69c961c581e68362843ef0ccef5ac6bcef7f63704c0");
+        api_test(input, output, "G1 multiexp: BN254 16 pairs");
+    }
+    {
+        // Later runs go through the cached fixed base table
+        auto const input = parse_hex("0268259362ffe4eeeab4198826f2a6123c684cb9e1cb9776a641521a8e584ad990b3a95a828a22b542cf9c2e9e5fb1f800bc266b1bc34b4485c4cad7d5dcb588ead513c35d1110f39ed3e6f6701f1344c197b9e2d148ce4ffc5d00c209f75a4e68ff10a2c9d2cf7c567f000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000024603acd52f0a8a647b7d70f565298a1b3e4a5349641b7c7c35db0fb47fbe2e757138c5c08dd21d76b9954307b68e400bb3f912c3b60c0b7856ba09d6e396a39852de12492760f11bbd8b79002c5eea2c3757d43fb6bd5dbe7eb38c857a8fadad489188185712e77792c2fca45adb1a75c95f19c7556ede577fb6483c59af5b01f83d3abe6795f3ab19980e1aca89f70025ae6eaa1e276afcf5a852cf3106be6a0614c27f812f83c173d45c04de620711b07220f30996f3652eb0e61b07df94b8e9b0717f5858564efe837d6164f6ca77e0babbbe1f44c780e0caedea5839cc114034f7f20c5f937edca1b026d7c29542222de53f9c794dc976b983bbfdbe18868a2ea1a77705688748469e13331203dcaf10ce79816d7b017c26dbec741af0a354ebfba7f9a82ab4c41ddcf0ebfd751fb0ab731aa6ffd42e1f38f35fd682bd1bdf6a47678818bd8a823cbf323c31040d5a2ceca884850229534825f324");
+        auto const output = parse_hex("0fccd33a00d85ba0ee3ce8571406aa2e2a8da22d682b855c0bd647513723ecc1e8595e9146d382e9ea3b9e8287a9e5776fa3ac3ac7a97c0595cc1bda5d3ef1efe4a9152d9bf3998b435d8a8d698e1186f5c856a9c418b97404d6f33c080ef7925fde8f63f7e4ef241d2c5778c7ba25b4a368c53649da84f8d25d1cde12ecdaf28c9756571355f9ac88ea7c1ed3f1baf902c6bd7b3e9cbfde4d1f72d74dba5caf003a729f7d9de60b1bcfb8acd51ccd2b663b81d2273ef8301c952e065fc90aadb06a625b1947687fa6514a700882f4d1");
+        for (auto i = 0; i < 6; i++)
+        {
+            api_test(input, output, "G1 multiplication: fixed base");
+        }
+    }
+    {
+        auto const input = parse_hex("032030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000011025caa11a16419f828b9d2434e465e150bd9c66b3ad3c2d6d1a3d1fa7bc8960a900c34dc01d6b8ab3a4624b5723271e608448fc938572a69526d88ee157898a3a106e6801f13c1af744e781d13ef23739f7afb126b280df83b03ad2438d805970076f571969b534cae96d326b5fb23767694a6617df24832191c2f5ae60458986248228d7c9ef2ea73edef383224b14c113bad417adaccef08d7af427e432586a25f737ff065a52056eaf3f1d6fbf1b3860008e241ca8871c20fb6b84824a13eb21673092d11c88378a859d7f3af3f120a8888fd61a8249812d76ecb7902e7ecc1b910fd35cf475c429c3941a3337c4cda624166ed05ab968f2a8d83d9a853fa615db36821788bf363496d2f8454bf5b71c776a1e341c1667c81d0e18ed99280813a8bcffa0084eb3d59ff585a3f3efd7aa820d4aa2fc86faf5a634c0d58e4b630335ef58bf4103261269acf8263f72a9b79f5b28e106917f13d1d7389c6eec47240968f8818dd8410bab35fbeaf590d18852c9db3fdaf1376a8e5c4cfd3641be15abe690ab1098c55701db609a7eb252d35a0c581fee5d79862dc331cd82ffeb1138cd1e817ba37a88a1015b04f560a2cc336054afc86b52f1f74c28f7b8bea31c08c30118786ff2ff41a575bb96167b528bc8a33b1b140e51d56fa26dbfb2ad08c3dd7af5b93c2b8dbd25d28c0ebe09b7e98ab97d9bc4823373f99216b85af824648c2d8a7fd386947459b512eed2e814c155f53a561ce22a7c13f8ff0160c614393c0e706cb853297943246b17ea034cd412e9249c6913544a49b842b77c010c05b8a015795c00ddf66fc4ab462d509a627fd670097e1149a2745f34ec191a159e73e71d253b9be6e0b5045482b60837220a07f5e264d4a015723162b0a5940ecb29ac09d108c9c528603f3ab9e8c06dbc6eaa5a420061795dfefeb10d530b282c4fb1bb0cfde0197c021b95ba26b2fccca06a13ba343a1d740260e85bf3270d4e73e082db4ebf9af9d38f10355d6c6569337f725e48ed9bae52d98066d158233cc261be2c3b10f81a96dd13727a51d919daf14456f4574546eda786a9e93a194c68aa91d38459be5b9c7f94c63577e2610376fdd0d6685c32310bcbc57fbb014ff851457778fe247b26fe46ac14ca48e65ae5b6aade07a3b3b362fb0ace490bfb9aa60472acdf016a47f3c34666c792b9d4cbd606902ca542281611bfec8c2701787726d2436d2955e5550ec82007388e0a3cbaf7276f26278d0e76d0254513e48876419890e8e82986f63fc1d3a91adca1b2e254bc09a21810577a66120e0dba6d146fea5e0705372d974ad792470512c299b3c07420b507b285732f67482a9ccea7a7190768c59f993d56ed62a02fb0557e454fd5afc65fcd428622ac491738d0ad5386c0be036a324743cb0efab15960e868ea4c5517e8c7c0c4350ad91269778bacd6256aa8069042ab1bcbd4d19924a91d8f7ae6e7fc7940f592121a1db76d9e632254fe9132f030f87bacdf605cd83e06999541b02610e43db59e362980b9348ea2bbc35604edc0455dfa953e945478721f914ba010253d54a3282f27d4b561fc3570630ec7aafba6150c6ca04ad6f2af85d9f58b1365a3aade6aaf2f2e92632a808ad8d84f2e31dab363ca07e38cd9a88be8d256574715ee9a5371216c97f442a0f13ef3ff9ab981940ba5cabc7537356f2f654faf59d02e2638fe2947835c2102d6b9a61ff45573eb3c87c631c963fec6be3ad2eac6fc52b27b3d156cae2b40692ff1468efab180693f3c084798a97a83ae37de48bfaafe2c6a6b0e5ee3fd01efac6c464a030d7c704da4bdecc941897566482bec159651f3cdb31dd193cf0335bfd0b4387adb5c261ea3c16f910db74e8e202b90d79dd449e01f24edde2bfbf4f3e102177a10c83c371ac406cb650267a7f6ebcb0715845b36b100605d7f5cf44a3344db8a8853d1f43f8ee4a75ad59c9dcc2d866eeca2825b810da6681dfe07168f54e7d9169849e034dc83cbc80b08fb1cba37925710682d33231cb11995443a1f22404b8cd70a2a356f2189dc637feef577133411b137d4870b4e9c891957b12676612d6e7dc8b97571526a8b56ba4dcc420c576f37defd6f1732ff01109588dd294c161afc70182804e85057fc028d2b358c0de63d122e18");
+        auto const output = parse_hex("0406ca776c8cac70936aa92ec7ab9f8c4e0748af8f8bf82454e2516c6230aeca01f2401740a27d310b17a69c961c581e68362843ef0ccef5ac6bcef7f63704c0");
+        if (auto const err = register_multiexp_bases(input))
+        {
+            std::cout << "Err: Registering bases failed (" << *err << ")" << std::endl;
+        }
+        api_test(input, output, "G1 multiexp: BN254 16 pairs, registered bases");
+    }
+    {
+        auto const input = parse_hex("03301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011203e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f773eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec13134b991d762b8b1a47aa3fc17d9ba845e40b2eaa635ffb86c8769dd09fb2a724d803e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f700000000000000000000000000000000000000000000000000000000000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec1313000000000000000000000000000000000000000000000000000000000000000003e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f773eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec1313000000000000000000000000000000000000000000000000000000000000000003e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f700000000000000000000000000000000000000000000000000000000000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec131342f139573d3c2ce4141dff2e5f717e79b2ce7b4229f739ebb0aee211b0815b3603e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f773eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec13136a28ef6c867e9c7bfc87b6cfbf9a5655eb60a97507b884151114f501d7b25a9e03e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a7515059f73561d785e319129f583c4eeb2d252ed7b517b4c4032c501bace4f6cdd8116beef78e3a073a1136315e47f99ac9e00000000000000000000000000000000000000000000000000000000000000000abeb2a9e896597b42f93db5e6ffdf0307950c2c681f50bdabc89726c23ed2987e75580d203d4ddea27da0c13a8b559312f0df17f47e40ab3443b141dcafa9d83ed00e0f5e7395876ca24eacf7344fbe5a544c38793e4f2f0234b21456ce38f700000000000000000000000000000000000000000000000000000000000000000a0dcb53b758588dab73295b344a54b842c18a62ef48e8d550fd9d3f85d5169590b2b633956b8c0ca8499b926b5252e31981ab4b37ade86559cd1545b6705c8bddba548aa2d78b7e99bb10e04acae72485e14c563db5771d98589aff89ec131338b695338afdbabf0bef2adc95f0c20e993d4adf29526d01108c8ee2a8568866");
+        auto const output = parse_hex("0313b3ea7c0f64758261fc1dee8502620cb73be80bedfde42627e30ebb5f5152e3079a433b40cd8bc82b3ee0187c8cfe0fbfa50de99c60b6090a00ca1a45636b6a18e05afb28c98d6bc024fbb20024c1b2df7f154dee560338e350da860bd888");
+        api_test(input, output, "G1 multiexp: BLS12-381 repeated points and zero scalars");
+    }
+    {
+        auto const input = parse_hex("0220ffffffff00000001000000000000000000000000ffffffffffffffffffffffffffffffff00000001000000000000000000000000fffffffffffffffffffffffc5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b20ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63255142ac475023bd6b91249adcfdc6bc2590c8606b23bd9edda8b7bf60b0fe731e8479d82008e58ca3a5c41ff82533288f0ddfb05a0c9e2bfb275a27759c2113d4e4bc944c3fe56c297e8709fec007546dbbd1a1c00970d5caf6be44db9be1374045");
+        auto const output = parse_hex("d5e388ca0a6e5dc755f5dfc8e32cef3e376b3b14e7d5637734b128e097355a926f4be67ae37596c492365a02503570533864a11c934bdd3a6b8fcd299800014b");
+        api_test(input, output, "G1 multiplication: P-256, a = -3");
+    }
+    {
+        auto const input = parse_hex("842030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd470230644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd460261aefaf23e323d0b9bd93423c86d301dde7969688613dba6348e784d5c55c7226729e0e3236d1a3c1bdacc18e193311dba12677e1ca5a1fef518a64dead645241733f1deaf484d3084e53c2716ba6340a4631ffb77e567412113cef1d918641f224315879f1045380c800eb290b936888acc737c96b29c15ad18dc5aeb62901a01000000000000000000000000000000000000000000000000eb020d03dbd60845a47eb54454412532578a7d303784962561741093fb8e451a21d51ff99bbafd54767b1a5c51722e54ebf98218517c1ed6257721c9cf64aa0e66f6032e17106e41f058557c61945f7c62bb7d0fc89bd96bd4c0d15aafac3bd2af84a507bbe1472cae9f3eb3cc63a7a8cdd1e0cb7dd9210b25c4e0ff316b2980215642");
+        auto const output = parse_hex("257642934bf8bf84633dfd9b19501456dc09c5fba9be8bbf94b4dc83cc7028a01492331a08d3a1a47b9fff1555b6b267da57cc40815866082815194d6b81cb982c44ec859d5b203846dd0ad98ca00d720232077d8385c3d770e83bcbc44deff60b6255e07f96ad7d3bb9d3671b56671063ba2fecab415b6a87befcfa47da2469");
+        api_test(input, output, "G2 addition: compressed points");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b6716600010101000403649242ca85b69812c64cfca6c371a6a8bc3e0feae3bbc1bcb91bc1b63dbe823359d253be3a02ec8d46b0bd28ee78ea3e91133f32ac81b3701a724300b7ed16d47de59cafb0c976757c8b39014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4600e1962872a71ffef51e92106860411eb4d5907ace16da3121ae77b59c302c528d7360c1754f033888e311fd8469d8545b848df832a6937e466cacab8c75126b14fbae3a164ae7fd22195f34011a7e06f9f96501c6b079dccdf34e839ee1e14bb83bf32d320062f05b0630c90744bd66bf98010a8061597a828966f74c49c423107e80b4fe8598cf8a8e7216592f30bf186198dc2de688eb01e21671acd1c49324b8bc7e30d8bbab88358d7ba4ce53d015811132e07d35c2062480c981ef007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4602db619461cc82672f7f159fec2e89d0148dcc9862d36778c1afd96a71e29cba48e710a48ab2014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4600e1962872a71ffef51e92106860411eb4d5907ace16da3121ae77b59c302c528d7360c1754f014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: MNT4-298 bilinearity, 4 pairs");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b6716600010101000303649242ca85b69812c64cfca6c371a6a8bc3e0feae3bbc1bcb91bc1b63dbe823359d253be3a02ec8d46b0bd28ee78ea3e91133f32ac81b3701a724300b7ed16d47de59cafb0c976757c8b39014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4600e1962872a71ffef51e92106860411eb4d5907ace16da3121ae77b59c302c528d7360c1754f033888e311fd8469d8545b848df832a6937e466cacab8c75126b14fbae3a164ae7fd22195f34011a7e06f9f96501c6b079dccdf34e839ee1e14bb83bf32d320062f05b0630c90744bd66bf98010a8061597a828966f74c49c423107e80b4fe8598cf8a8e7216592f30bf186198dc2de688eb01e21671acd1c49324b8bc7e30d8bbab88358d7ba4ce53d015811132e07d35c2062480c981ef007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4602db619461cc82672f7f159fec2e89d0148dcc9862d36778c1afd96a71e29cba48e710a48ab2014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("00");
+        api_test(input, output, "Pairing: MNT4-298 G2 points prepared before");
+    }
+    {
+        auto const input = parse_hex("07022030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f000000130644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd4600000000000000000000000000000000000000000000000000000000000000090000000000000000000000000000000000000000000000000000000000000001020844e992b44a6909f1001428d574106c9ba2174d70abfa438376e7b37c573e5338427b525e3c4423cc296f001f5be7537cd1cd5ccf74864a71a4148cf7b85c264e15e784bf9c82cbea2e580493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b08ee307a392456de3eb13b9046685257bdd640fb06671ad11c80317fa3b1799d01f20ce266e9b4f8af9c10d0e7dced97d202645096d001cf3250c37a4ad5098c0449266cc377e9ffa89c250980d0f4767ac79af1078da875fbf039702de15bb3171bd85457f732e688ce0f68121f471962d073c99c19f9eceb561a86d7926c7b264f2f554f3bc18f172cb7470e1165d1efcf955d2e1e611de76da045cc845a2c08d9e17ac5ba902faf3fcbfd50c9345306006dd3d9fcbb4b2e0f69db9218fb662683322d36f1c6fee6064b91f6f52e4ac07567a5a925674552b5d039bc892ba20747116f51c23c2350946e8f52c88df2a21e60b5bea7b1495801234beae1feca25e24413c6db43afcd282f9083dc8ff20b25aa8d64ab99bd17ea09a368afc0192c417ab596b2b7693ad3d1f4f29103f9b73ee8054c77351eafafa34ad3d5c6af07a86bd7c2dea4f05c9715e59a9ed2319da142c59f21a98464f865b87493fd7724455d342e46869cab39e5a0a5caa6ad25878017ab0595a0944ab4a8f19a70ee25caa11a16419f828b9d2434e465e150bd9c66b3ad3c2d6d1a3d1fa7bc8960a92fa100b2c3c6157613edfa5f5e5a39fd13386dfde2ff23f81547fd3580f3730d06ade44a01af9631bb726da6cd5bfc5ed64ecb7c1ab700fce4c13d87e231619f2575be3e3dede853561d48bcdc1f1824f355f00c8008f49e05333d275ea64df72ee4657172a7cc198835b856a225027c28c948f9119ea233716affe98fbfe4a92cbefe3428704e20bb092927fdf360ec9ca041c522e34164a43cbe6e292edba9253f59278c1c80673da245e11e33efeefcfcb92bbce7620126b9b0e36631259029476181881aa74d1525e13408424bcc0141f5b33d9af7e785086d59cb943691218826ab6b96748041eea3b0fdabaf5fe7eeb7a5791f04a46a0f553532f992ed0dbe0714a0dc3cd3627b2a576d813b0136d7f555305f9d4e93de078d760f8ada15a4b16601189314c6d536efe502c49c5d9d2c9d8d3788f3be685bc84c1f9f920bba39db62fee025a9004738e06db210062f39461291809b585f3fa8de54941826877991815ef6d13b8faa1837f8a88b17fc695a07a0ca6e0822e8f36c03119926d77935e0d6b670014203311d19e83b86fc2b423a8b348adfa4af40b55035dc10f651d88897ff73aa34f44b622e68feac8cd3cb97bdda3611043794b40915240efda7a748a9be9bb31db00222ab53aea812d1366272e8afff04749166b4496c21ed3cd0109eab5f23eecdd6606c0fc76a332c826e86173dba2d958cc623220b24da644dae1ae59ef02439e296c3d96f42763602e1538008ba50ce7aa942c1f420d87c46aa712993c5908924ffc5602fb6d0f11fbae14dc6bd740ab37087243927e0a7d808d75cab99826184a7cd419dffffe0b8a3438ce994a18029d12800c51dd7680263c2853c84af04494e3ee1d0f4f5912cf3e1a267445b7207b79842a90e67dc5ca2877fb802fca59f3891b23e4a7e2b7c56becd9694687c1be5e3b7460b2ca4dbdf4e264f2878d81b20622a4b91d436b588354b6c404d6c94851f3b610d44700714318c0fee0a4e2fb0f5f4a3ffde92d423661a954510a090d8f5aab00dc7b35e27cd813047229389571aa8766c307511b2b9437a28df6ec4ce4a2bbd096ffae0637344110e2ee3a5cc4b054f37bf93487fdf756287f0b40b9ae432bc1817aa8a4eaafaa2e12a3bacde80d446e062c56ad3d326fa9f671ce67fc94d3d1cc8777189186af564e0368c78a30b164bb83a23913ee6ab2bf694142824b51420aea7ab8c031829f7967c63344428e73f475cefd1d5aa54fcc1698b968a4f920e1a93b090bfde39c9e91a1ed203eef723d3e0ca0227af15eea77d331b20edf9269b1958892174b7515bcde5ac058fcd5ad0f55d632561cf8301a2b84235fb6a05089eb3e96819957de9f0bdb8bbac3e6d017bb9e6f0e71dd58d67854abbe2870493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b08ee307a392456de3eb13b9046685257bdd640fb06671ad11c80317fa3b1799d01f20ce266e9b4f8af9c10d0e7dced97d202645096d001cf3250c37a4ad5098c1ff562a58c25180375673011cc73716defab8ca781c34948a959bca993c4afd60d3b9d4baa26a14df308344b1a3a352282f021ffc2e95e59a9f1800590738bf02a48ba8a2740ce75b12ff15a8199cd46d5f5542fb3550eb879be2f60a75cfd1f2e4125ed3d3da5a1eb68ef8aa2be7e5ab0aa8c23a1eea18cf50681684c4836722550890ef5a0af5bba2c99773303f37666ec3871c72829ae267ce83448a2e43e2a7404b558c118f40831f9c9e196ad20c21105c32ff661954e59b52bed7533fa25e24413c6db43afcd282f9083dc8ff20b25aa8d64ab99bd17ea09a368afc0192c417ab596b2b7693ad3d1f4f29103f9b73ee8054c77351eafafa34ad3d5c6af07a86bd7c2dea4f05c9715e59a9ed2319da142c59f21a98464f865b87493fd7724455d342e46869cab39e5a0a5caa6ad25878017ab0595a0944ab4a8f19a70ee25caa11a16419f828b9d2434e465e150bd9c66b3ad3c2d6d1a3d1fa7bc8960a92fa100b2c3c6157613edfa5f5e5a39fd13386dfde2ff23f81547fd3580f3730d0075593af2472c01ab90b564241cc1bd80f1041979ca587a1e380c73818401f71cfac86528fc70006ca129e0ccd131988806b654f7b22f243c0b05db89db0fbb2c5ad6cfc889fbdf3d063efce9043dc926605fad19901b24299fd6439f04e7fc19d4629528954b99cf0dd3ebbf66740964de0870994ada2bbb54744ce11046d220d38c783eedab25d0f62db43d2f4e4c6b1a25a2d47c4dac8b4fc251f82739ad2257da62f74309421e1a630f61a88b7a01a78f0bf75a34d96457d4e9f2db322b218826ab6b96748041eea3b0fdabaf5fe7eeb7a5791f04a46a0f553532f992ed0dbe0714a0dc3cd3627b2a576d813b0136d7f555305f9d4e93de078d760f8ada15a4b16601189314c6d536efe502c49c5d9d2c9d8d3788f3be685bc84c1f9f920bba39db62fee025a9004738e06db210062f39461291809b585f3fa8de54941826877991815ef6d13b8faa1837f8a88b17fc695a07a0ca6e0822e8f36c03119926d77935e0d6b670014203311d19e83b86fc2b423a8b348adfa4af40b55035dc2f82a1454aa4ed13e181afcefe3bca9ffe111585d54a449b2dc8567d4c09aa580f0c118670fe1005967b919a9522ac03764f4f778e5f08009f79b857a3078cac17accc7acd7d4a4ebdf82b0201b0aaa04f39028424c788cde2eb5f29fa5057bc117ac513449c865af395753616754caddfae8fcec97f2af35e5fbebb77c482c208287bcd4aefc433ec51e52f57a757bece873d952b45d4018fe0213b051754eb132f41924d68d28b5418d907311d1745160e620c408ccbd91963dbc1273840651dd7680263c2853c84af04494e3ee1d0f4f5912cf3e1a267445b7207b79842a90e67dc5ca2877fb802fca59f3891b23e4a7e2b7c56becd9694687c1be5e3b7460b2ca4dbdf4e264f2878d81b20622a4b91d436b588354b6c404d6c94851f3b610d44700714318c0fee0a4e2fb0f5f4a3ffde92d423661a954510a090d8f5aab00dc7b35e27cd813047229389571aa8766c307511b2b9437a28df6ec4ce4a2bbd096ffae0637344110e2ee3a5cc4b054f37bf93487fdf756287f0b40b9ae432bc0a86caee00935b8b1934b0f4f407ea4931ba9b398b3326fa9c3e5890e100ea6023b9f4b77843b96112894a8a2588bff4e082f309e507c2b4b2ffd320a99f780a2eb60e1d5cd4091de9f6d15b694db4949e310550b3e7294f4e2cf3920de1f0c903eeb944e40ee2950fd58e9fd97bf835e095b07b4e752bbd75063230677f07011c2e5e67d1214b96abfd4de553fad7a6ed82bcc2f0d5e7075f24e10c8914846b1e9d77ecebe159c9b1f3f9997ee03586333425524a57586670df25e10a06df840493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b08ee307a392456de3eb13b9046685257bdd640fb06671ad11c80317fa3b1799d01f20ce266e9b4f8af9c10d0e7dced97d202645096d001cf3250c37a4ad5098c1d595c74a4f0887b061d41655dc055aa72e0a033c4c9cfc7a3d8635fc89069e32888b0c1229d0d32593e2d25cebd8ed2c3f21bfbc8ae76cd9340c96e69ecd74e0964fc0caca38d93581a92146ae048fca7ffa6c4931edf61ac907487d085aeb4233de2b9abf895f22ebc831c940603b780c331de4089ae08975514d4834057f2114bf5736c7444fcc482076322f78cd563e3c9d0740726e5806c884a9cd047c70a584e2dac3c95d5917418d4381d0ebcaf3012dfa0bb1eb0f6a9dd146438abc925e24413c6db43afcd282f9083dc8ff20b25aa8d64ab99bd17ea09a368afc0192c417ab596b2b7693ad3d1f4f29103f9b73ee8054c77351eafafa34ad3d5c6af07a86bd7c2dea4f05c9715e59a9ed2319da142c59f21a98464f865b87493fd7724455d342e46869cab39e5a0a5caa6ad25878017ab0595a0944ab4a8f19a70ee25caa11a16419f828b9d2434e465e150bd9c66b3ad3c2d6d1a3d1fa7bc8960a92fa100b2c3c6157613edfa5f5e5a39fd13386dfde2ff23f81547fd3580f3730d0b8e680e415fc765e4038c79fddba4cc6821363f42498556902f6258b049e9fc1c83247574670a62f655831a94f2467e969403505e03f9c31f123644a7c0bc3200ab9c0ece9d71d8ee5e26845617b8273386ea497e52b207cc8e34c20e64cf191222fad1d8c5f6354e105cc26d35dae1cffdefd0289ebc23b87ff89f83edd5a2");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: BN254 20 pairs, affine preparation");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d20100000001000001020eb374a4ecc326b88597ebbfd9f7e0e46c14fb8f0cf298634dbf17cedcff000f9ddedf0131e276e233ed12af642783cd13600602e5bec5f08451d91c215b0dfca7c9d73aab806273ee3a5469edd0e29782c82f1418bfad8755ba4262726e13920cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d03e49a0584c7b305ebe07f955ba23b084ff09446fa77f5973fe5c11e1b51d631617a9655b055aa00ea6c6647da0a751514619e941c078868b9f1b2327e5cfa051189d0337838d28ca22f17d2a74418a307ed1085cdb38c5ea69bea1b8065fe0d133452db6b1d5da39298f80f26fc2a86f20ecaa8a947ac60aa179d25153e1048a3e58bb35df66804ea2ebcc1f2cece8912bea2061e1ee292e5b039081355cbc6a69c7b0bef9ef61b054277c7ded98472b08a88d04a5c0660a08f264cb2d237ab0678cefe28f3345f880f78c5c3869b94cc17ee0e7e701f93c59bf0e2f1308cb6d74401d9f27595b0b83636e2e6d2d6c8092477a161b873e044811d64c5e43a00773aa00e541ba3d76a6973830c8b6ad79d8bf0c61b884aba845dfc20b76f830d");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: BLS12-381 bilinearity, compressed squarings");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b67166000101010002007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4602db619461cc82672f7f159fec2e89d0148dcc9862d36778c1afd96a71e29cba48e710a48ab2014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4600e1962872a71ffef51e92106860411eb4d5907ace16da3121ae77b59c302c528d7360c1754f014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: MNT4-298 G2 point cached");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b67166000101010002007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4602db619461cc82672f7f159fec2e89d0148dcc9862d36778c1afd96a71e29cba48e710a48ab2035c8c320f89f1347e0cdd905ecfd160c5d0ef412ed6f1cfd99216df648647adec26793d0e45030fd9196ada4fcfa583e1df8af9b474c7e89286a1754abcb06ae8abb93f01d89a024cdce7a602991bc31d172a34b9759baf558ee5a716e96321e3e2be374a47d14d7ebd0ee358d5b3d7e8f8029933ddad7dd89024dc49ca3b0f63de1bb2ef66001fcc187dd03380532abb36e05ef7cb9f72007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4600e1962872a71ffef51e92106860411eb4d5907ace16da3121ae77b59c302c528d7360c1754f014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        api_test(input, {}, "Pairing: MNT4-298 G2 point out of subgroup next to a cached one");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b671660000002e03bcf7bcd473a26620e0aff3801b2888a4c5b562dc5b76bb19faf40cdd288762f2fc2045f1ee36f329a58e99ffff08ffffffffffffffff0101007a2caf82a1ba85213fe6ca3875aee86aba8f73d69060c4079492b948dea216b5b9c8d2af4602db619461cc82672f7f159fec2e89d0148dcc9862d36778c1afd96a71e29cba48e710a48ab2014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: MNT4-298 final exponent word of all ones");
+    }
+    // Same results with complete formulas
+    {
+        auto const input = parse_hex("4120ffffffff00000001000000000000000000000000ffffffffffffffffffffffffffffffff00000001000000000000000000000000fffffffffffffffffffffffc5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b20ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc6325516045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2daa1da2bc221dd82cf0da85bebbbdced33378726275de28546b22aba343dbc97b60451bb9d07cd20f9ea959ae358f3e52034202e72206919cf6e82bcb26a33fe9af20922a5bf2d89f9feb9fcc346077468c69d78009de9c7b4b8223afe9ab154");
+        auto const output = parse_hex("9bbc34a3febcda6b9d46d2a0b4f008cdadce5b8d650a6df5b1a07f8842fb02076c79522f118da6d21f4703290fd52b38392ed5929af74a00df09c9c44c0529a4");
+        api_test(input, output, "Complete formulas: P-256 addition");
+    }
+    {
+        auto const input = parse_hex("4120ffffffff00000001000000000000000000000000ffffffffffffffffffffffffffffffff00000001000000000000000000000000fffffffffffffffffffffffc5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b20ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc6325516045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2daa1da2bc221dd82cf0da85bebbbdced33378726275de28546b22aba343dbc976045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2daa1da2bc221dd82cf0da85bebbbdced33378726275de28546b22aba343dbc97");
+        auto const output = parse_hex("d9af407a673e8e30474428cef10a6e5385d6d002ad8b4fcd51ad3de7cefe7424234f38887477e98e3d6bdd36debd73a0ee774b6ddecdebb0fe548b8daa49726e");
+        api_test(input, output, "Complete formulas: P-256 doubling");
+    }
+    {
+        auto const input = parse_hex("4120ffffffff00000001000000000000000000000000ffffffffffffffffffffffffffffffff00000001000000000000000000000000fffffffffffffffffffffffc5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b20ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc6325516045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2daa1da2bc221dd82cf0da85bebbbdced33378726275de28546b22aba343dbc976045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2255e25d33dde227e30f257a414442312ccc878dad8a21d7ab94dd545cbc24368");
+        auto const output = parse_hex("00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: P-256 addition of the inverse");
+    }
+    {
+        auto const input = parse_hex("4220ffffffff00000001000000000000000000000000ffffffffffffffffffffffffffffffff00000001000000000000000000000000fffffffffffffffffffffffc5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b20ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc6325516045ade2aed81252dfc35a566b59044c424979b4de1988db8dc4f2e50fb187e2daa1da2bc221dd82cf0da85bebbbdced33378726275de28546b22aba343dbc970000000000000000000000000000000000000000000000000000000000000000");
+        auto const output = parse_hex("00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: P-256 multiplication by 0");
+    }
+    {
+        auto const input = parse_hex("4120a9fb57dba1eea9bc3e660a909d838d726e3bf623d52620282013481d1f6e53777d5a0975fc2c3057eef67530417affe7fb8055c126dc5c6ce94a4b44f330b5d926dc5c6ce94a4b44f330b5d9bbd77cbf958416295cf7e1ce6bccdc18ff8c07b620a9fb57dba1eea9bc3e660a909d838d718c397aa3b561a6f7901e0e82974856a792a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa7aaf5781891313953b8332607b991ae91a6d00afea1af63af5dd8405f61e87d992a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa7aaf5781891313953b8332607b991ae91a6d00afea1af63af5dd8405f61e87d9");
+        auto const output = parse_hex("2d3bdb292bd3e1454d390ec7e30b091aa323ec9363cbca74197441ed7bf424cc6325ee264cbde88e8e3143d0fdb7dd2e7448acf881caf022506ac1667e4cb190");
+        api_test(input, output, "Complete formulas: brainpoolP256r1 doubling");
+    }
+    {
+        auto const input = parse_hex("4120a9fb57dba1eea9bc3e660a909d838d726e3bf623d52620282013481d1f6e53777d5a0975fc2c3057eef67530417affe7fb8055c126dc5c6ce94a4b44f330b5d926dc5c6ce94a4b44f330b5d9bbd77cbf958416295cf7e1ce6bccdc18ff8c07b620a9fb57dba1eea9bc3e660a909d838d718c397aa3b561a6f7901e0e82974856a792a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa7aaf5781891313953b8332607b991ae91a6d00afea1af63af5dd8405f61e87d992a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa2f4c005a18db962702e2d83021ea728953cef573eb0b29ed2a35c417294fcb9e");
+        auto const output = parse_hex("00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: brainpoolP256r1 addition of the inverse");
+    }
+    {
+        auto const input = parse_hex("4220a9fb57dba1eea9bc3e660a909d838d726e3bf623d52620282013481d1f6e53777d5a0975fc2c3057eef67530417affe7fb8055c126dc5c6ce94a4b44f330b5d926dc5c6ce94a4b44f330b5d9bbd77cbf958416295cf7e1ce6bccdc18ff8c07b620a9fb57dba1eea9bc3e660a909d838d718c397aa3b561a6f7901e0e82974856a792a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa7aaf5781891313953b8332607b991ae91a6d00afea1af63af5dd8405f61e87d9a9fb57dba1eea9bc3e660a909d838d718c397aa3b561a6f7901e0e82974856a6");
+        auto const output = parse_hex("92a73a1d9824475f888146ce2f57daa64057c22ecd6cca5d07e5c7f8775bc5aa2f4c005a18db962702e2d83021ea728953cef573eb0b29ed2a35c417294fcb9e");
+        api_test(input, output, "Complete formulas: brainpoolP256r1 multiplication by -1");
+    }
+    {
+        auto const input = parse_hex("412030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000011f36c831b50036abcb30936c35371fca245da63376994e7ba827d663649c271b0ae04ce93d2593f79776fe76205143587bdcfa1c08721443acc28aa62a313b7b1f36c831b50036abcb30936c35371fca245da63376994e7ba827d663649c271b0ae04ce93d2593f79776fe76205143587bdcfa1c08721443acc28aa62a313b7b");
+        auto const output = parse_hex("13a41c32444f2fd33c9c7b8808f6937572f8c678115288b71fb2265b52aa404124021a2400caf9996cc4354bce188f2354f24bdf160c92439a032a151dd90170");
+        api_test(input, output, "Complete formulas: BN254 G1 doubling");
+    }
+    {
+        auto const input = parse_hex("412030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000011f36c831b50036abcb30936c35371fca245da63376994e7ba827d663649c271b0ae04ce93d2593f79776fe76205143587bdcfa1c08721443acc28aa62a313b7b1f36c831b50036abcb30936c35371fca245da63376994e7ba827d663649c271b25840189a40c0c3220d94740613015051ba470755fffb6498f5e0170ae4bc1cc");
+        auto const output = parse_hex("00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: BN254 G1 addition of the inverse");
+    }
+    {
+        auto const input = parse_hex("422030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000011f36c831b50036abcb30936c35371fca245da63376994e7ba827d663649c271b0ae04ce93d2593f79776fe76205143587bdcfa1c08721443acc28aa62a313b7b05fc39dfaaebb6861b517272255a3355664288d84d299e5e0eb12942d8b60441");
+        auto const output = parse_hex("16767602259ebf73b1c4419027e0837a8838560c4b96c296b954667e0d6126fe1cbaefab16834d02c0176eca642a2bb13fac02b22d7eaf6f382c61991a4e0e8b");
+        api_test(input, output, "Complete formulas: BN254 G1 multiplication");
+    }
+    {
+        auto const input = parse_hex("442030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd470230644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5009713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d22030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f000000106578381d4cf4541e1a23121a5f8418621cf5db91425b65dc4b20d4aa7351d36161e8e23ae9b6346d896c3a75411005d67ba734459a2669a150cf88a04f0f9f802d58dc6a866318490659d8b5c5650e0d85fe857056f2c73c247f22d4e20055711bb4ca4e9b662804a3f980db74650ddd475f7afbb9fc37d4696a9ddb84f9b6022efaa05104916e1b1e914fa502e09c96564e965511f7ce1f2d130d04901636d14272c0d948a1981797c42b2c32bc3762222085bfbd31011b864e6a6ec867421236f9ab6d54618aeced0c86a04f151f7c39f037102618b113183401d05f03c0915cb95c91526003bde0e25b367856b393b044a52ef07004156ec52c69457f5e0");
+        auto const output = parse_hex("2cc9af4586b27f0335790ac7f27c74b30729de889210efd2aef0d1479e0e9c1d2c18eaae8994cecfb55077decef93593380ed7983e48d436434ce9290c7162560442e7bad05303f553f1cde44af6ae076dd0500798918e5c4764100ff5eea8cf0c4e93b069d1bb9d2b82baba16f2389f04af31633bf1fba879841b0b03574f42");
+        api_test(input, output, "Complete formulas: BN254 G2 addition");
+    }
+    {
+        auto const input = parse_hex("442030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd470230644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5009713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d22030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f000000106578381d4cf4541e1a23121a5f8418621cf5db91425b65dc4b20d4aa7351d36161e8e23ae9b6346d896c3a75411005d67ba734459a2669a150cf88a04f0f9f802d58dc6a866318490659d8b5c5650e0d85fe857056f2c73c247f22d4e20055711bb4ca4e9b662804a3f980db74650ddd475f7afbb9fc37d4696a9ddb84f9b6006578381d4cf4541e1a23121a5f8418621cf5db91425b65dc4b20d4aa7351d36161e8e23ae9b6346d896c3a75411005d67ba734459a2669a150cf88a04f0f9f82d8ec0ac38cb6ea527eaa82b252b077cbf21823a63029e1979d899e98a5cf7f01ea901cdf77b3da96e10ada8ca3b077fc30b72e1acd2070ff589e239202d61e7");
+        auto const output = parse_hex("0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: BN254 G2 addition of the inverse");
+    }
+    {
+        auto const input = parse_hex("452030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd470230644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5009713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d22030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f000000106578381d4cf4541e1a23121a5f8418621cf5db91425b65dc4b20d4aa7351d36161e8e23ae9b6346d896c3a75411005d67ba734459a2669a150cf88a04f0f9f802d58dc6a866318490659d8b5c5650e0d85fe857056f2c73c247f22d4e20055711bb4ca4e9b662804a3f980db74650ddd475f7afbb9fc37d4696a9ddb84f9b600000000000000000000000000000000000000000000000000000000000000000");
+        auto const output = parse_hex("0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
+        api_test(input, output, "Complete formulas: BN254 G2 multiplication by 0");
+    }
+    {
+        auto const input = parse_hex("432030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000032030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f00000010516f4c1f8947a83bf7d4a50f81b44a5274f74590acbd0d078e5fa705d57fa770c096a1bd9211967f5990d565c6809c2da8928038692b955d3ba0f0b0764d1f2ce0b1a17d5166426023e4edec5de432e5ecaf2161205bdbe377c00f4aeb636d53e0ab11a6c04bdc9e12e0e4996ce0a9637bed908e93cd3593dc686c4eab1e149dc15f47e1b9cb6cfa1764189ef3d0d7feb66489d45d1d812ca89f12c6532f40eb518ca90ae3eb420db8dc8864959eb5c10e9b9ff16d36948f66c1a58d11f8fe12c26877991815ef6d13b8faa1837f8a88b17fc695a07a0ca6e0822e8f36c031199098cd53d005ae9b9b70e42856467702210853f4f2de696025c7bdcd6232cc76b09fa2840ce0c070157675f8206790646aa0de3994775400108f03e7b6f81f00a116806387e3c248ee13a6fe7f69ccc00f736ec1dbfff1714ff6df1bc29d15d5b20d1a6b0f68fac1ac17b93fbfdb2fcd57311d4cf45ecd3d1164280fb930cc47c0ddabed05a58e0c15e2fd18628c2c5f33d7cb9cbce10861dcb811a3cd618c0a30dc7b35e27cd813047229389571aa8766c307511b2b9437a28df6ec4ce4a2bbd26f453927dbe5c18aa216210b536530e5fc1d748e892552ab42fd80b3d98ca8b0e8ba40634568a23813c855c79d81d15f370bdbc4c18d04f354359fe94ab8cba");
+        auto const output = parse_hex("2ebbf071079d6f99eed3559eb58ac9cfc59f053d5b73a0f5d25c76a172b0b65123a7b8679585dfc98570b209ca3e7c09b6c40705870e203bf54c6cd1eb549d9e");
+        api_test(input, output, "Complete formulas: BN254 G1 multiexp of 5 pairs");
+    }
+    {
+        auto const input = parse_hex("462030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd470230644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd46000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5009713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d22030644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001030493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b0000000000000000000000000000000000000000000000000000000000000000142c4aaaa6535399b2ebfb2d618c09a0c6d870f376a6edbf1e6712d7801559f8001539200b93e49cf103735e331e36fcf165f968134e6dc3fcfa352f94fbe2f014ad3d7f27bfc5d3ac25d986b2bc8328ae1a26392fee6eacf4c31de4f450d9c20a1954b063186221a292664076efce63b9ae1f19d7e728f8a82727b42e1fce7c00000000000000000000000000000000000000000000000000000000000000000493ad77943eb21c288d26c3d72b50e08aeb0ea3188f93b46ce003403e649de91a7522452799286f941e43c22c8d7d4dbbbce35d98407c206e04d12bb9c1f17f132567ff575d3e3b4a78596d72d0c4af816960b4b231666bdb9060330ecdb4fe20c73c1a7167f5f6e75bba09550429d411235455c5d60be695eac01d5b5a195b059211f33ab0e96cbe637673b05f9e0835ffed0492067e9eb38f84adca822a60");
+        auto const output = parse_hex("1c524ce0ced0ce2d88853704a4a3f5940ee56c118834147c14796a91689d861c2d0ae9949eba6f3becfcc612a69e3688bff9f7702086ecc90175593bced84480019771df340ff4120b886af92424d53d564b748254870ae7aa5a3793899b05cd14221537749ede17d1514c21632017d8fbcf2f542db08fefc6488e40db6a7033");
+        api_test(input, output, "Complete formulas: BN254 G2 multiexp of 3 pairs");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d201000000010000010c0f963ac7135d4381347016264161fe54d7897714c028fa26264242c54f28d1e8175fcae8b956e39ad007627a8271c27f11ebe183a0babe1fb76616d0c878a7d4040e01f0150f338e6320f49e9de70d80c146e77c71190a44545b919aa338fd080f38b8109e6b0c7c0ca35884a9622c4b8cb6b15332a1a67c9a29e4b1c2ad75db1bb1612dc5b0687f1e7af00a4e1ef1000132c560c4ffd863153d404a2f72aede9dd4d51efb0431c7897e1f3010b66fdb64406b5a107f8740c92cfca357756ece0fc9202c6f350344c5f174254755a22652b310299daeb3c1f69435a7e642152df85278796b4e0b4ebf3fbdef0fb4d5730aa6882360aa710b7471c3e8672fb827e55f379afd34b68fef20052b9679b3492ac3b73c1379fa36f35fab637fe8a6f61526262a29b4de3ef36cece5d73f922808f87dced1603332d5254d7da0cf38e3aa3fcd9215d986138f8e1fb1fdf0f2eb10b5cd58fbc4fb83bcf014815e5c0023b1542741f0eea51db2af79d4d7f11888aa784f8d39cf77972a311b7868ef94eb0fe734b244c8c4dd004cebb41c3ef0d9bd71e8550c6ffac028c7b77512f236cf43269c9cc889b0ae8e862ebd0cc30b0a19e97ba2e50d70f0463da4bfb38aa47dc3746d98b76faabb9a37b31b75b25614bd67b3d2dbba6cba9c94582b2a674db909cec84bc4f527b8d2d8ae0f0933235c93f348cd73ad695c27457f619af4cf99a2d0fc95dbad70dd0161a42aff0ca9f20c8c0270fa0b96fa7625236a26f928ddc3e18b79eaaddcc0bffb5575294108234bceacbbaf07141eb242b19c2149d98d0b760cabc690b5a56c7da20784d738f988ed1325b144536f852f75143754a5f5f22692271c8ceddbbfafce49e6048620050b76f396c4ddf8a9c70616ae77e6cd8b942f23815344f3260e5b26886d19be4e5270fd0621836cc769c0e6e64ee8b60096667a13ab75330a16b32a8451b9c63142c31f0991bd8a3df8c3c0164fae329ddfc4e570e3addc14d781f4e2da2e7000e1acb160453f5484547d5432fc809dd087f2865383b2e3adbf225c9768b19fa698200269232e98ea8aeb8d50286981188295f98c9cdabce1c210ed61556730fae9cb28e0e44f837f403bb0fce0ae1efc73830f615e70525279db7dc66ec81e1598f0233e56794732d42e8c56a182dfd999c4a0019c2ddaecbab95fb5dbfa569c8bd765438cca33a59390a3609391da0930ec10bf092a92eef19ca463ab589711d1ed7b00a09439337d68d861c6c50f10ddb68f59fb3495c9913955d8f0969c04e4b3b54eb75b4aeb60cd6ad931e227a901fcccd4c85e5d267596deeef1fa627ea5b68a97f82d32063f5497d3e4c35d1074f3d763349c4803081e4d56de572b5b13c327d25c5efc39474999bdd6f7f623625142d20ac2f12c10bfb106ab209a014e013e8135554df5bc7d336d5864410db154170c244b777695433b65ed24c381089f9c74bb2cd8919cf4aca92b9dcf124ed3692b66c6815438d7b5a6bd6e65b71f58d1fc9f8ce9978d9f4ba44bf260138cef54b1e11cbb0c027052435627510fe744f0553d2527be47e949920bb0f3cee8548ee07a32a27c47d5b6db510f0edd0421cde7a49a3b8cd68dc4144848890502995a4d71c0fc0211aea736d072ad2168a3c5e973126025e58da3f1913aaef306b4f8213fe47df056eef5aa0aab0a0a45429310f534132aa9e71f33655fd9cf585459d0b53ba022ed40a55cbd5f7237b44ab4c6ad120b004ff1469184930d0942e62cd6c5342600a6c85acc70f110ba38492de1dcef728edbf3ade4ddf3740c617064640382b50217c847cf16d6b40f1f0e3bc9fcf373835ecd96a4faad05ccf92db4008ef000b5bc6cffa4331ecb62fc9038608d27c865e679b4995c53b10fc859e50a5c4baee31f56f9bc464545dd89f1e6ed2fc068379e8022c45c5038759c846a0b444fdafcd22c5c316316ed14b665db572f8bf779663b2e31ca8a4f96076a448ba440fc487e173f7544adbc145eb015baefc79cbc0b17cfd491b8c005ba481d8469e4c72d088ff78a222ffa470f7038d7c5f8599d2b4a174539d5ef576aa0bff742df68326f7666a054659901c7d37ef7418aba152f4ce79615cc03d52159e401b827006d52f8859b2f4c7eed971899b00ebe2ec821c37957f61af2134e33eaaa3eb17c1d7ce550360d93a5eb93cdfea88e6eaf1b41791d39c3a1a90c41706cb5f2a942e479d82d37a8ab1209469df3b02309022c6ce605d20bab82e33369839b13f4ef8fefd86aff90762e273450780be1cff6304f88a6c335e70117c4b5ea446cc6f315748f3c7c706cf107090d544c974a3cb62d0f17f96a416355f02382aa04c493fe46eaae93997833181348be2b648ea0481be40fe00928ff43e505199eb68b55324b5fe9d54d40be6ea0c9ac5c38b8821f006e35f25bab6811ee6acbe1d7a3a5c87db23f48b0b99908ff76e341d3140c506a25fbffe11ac4c5b56222fe3e8e5b1db3d1d8895e544f0fb541afebc56ab21822f1ef50fcec15d03345944cf045924d2dbb269565de3633fab9a4c79d7bbf5c334c7779725df906b993da3d186067e17a87324eb93f5e45bc0c521e07f56ac0576b0dda538e091cef977fd131e859dd34babc07a52deb0e4b20c0ab0feec33df7bba353eb6ad3bec586aeae55e08c3613c04a372a566208193d8830c99fd20d9b9aa041f650390f4381bab5499f59a205f296b5c4f1727bca88d1302744d6fd3c738041269474c03c94e6457c84feb87cb70122d86adb1704bf6d2dd87f8bc664a43f29321c19ef61f25cfb31d01c4e553b785b06c6648a221906115c0bc9d2a2f753e9d2c0e71688ec9ed0b13fbd5030285d4f517992f5d33f5c7438ad66e2596fd74cd3fb26a59c416118b068170bcb77d4e3f32c0401088a95458967c27da261f9070a54efa15c761115fff49b66fffbffea67c50b73b09820630d9cc535dd4fe833924dde19d4ed30aaaed1963c7f41c384692fb7ae0030429fb9b296f4b78e3d0de7118c404b84dca92b597c1b9b9e5468bb866c15e06875c9fd819fada18a85bb012935ff1565ad104c60a018daa760117b3c8f09098b55817448c20532289f705112ec11385a775d78c07d37aa11aada4077cf86ffa8c3bd898ac41f935400ec74a8df35caad4cea1a69ba7f7e96a83fb59c4819c3f15171d4c5888f3aadb334e5c0fcf41f3119b8a0f720645b02a4d09711fba95ce710d6271fad766617051ab287f709b889e6378de9af7e38941109bfef8e1ba76900c7408eda5d13719ca8d69b282fd0407b1a803a238cde9ff57598772709a7a4617652799a20bf00817c58739335658bead89144ce24b93bf0f74fda3ea9e7ac9304e30c8b249f79582ca5719708a2312e7725e45d3d9bae648964081dc7f9b6f82e42ba6cac385a10aced41a0673b71330b6d37dfa946208a5446301c010502491b806da79f52579aa7c4efb0b00ec26511304ec711afe33bbcd78248a5d406bb512195d121963f5451e3497916d75df19fe8db22dcb4117eaffb3ada525ae21e2f1e27ccbde9d9c25055838735cb7d64a5bee01bafda7b626c32b87f0a94bf99d2f746007b82952c68b141de9d17b8d3388e38cdbcfaad4bcab3f256fe74df674b0ba243031f1a9c3ca2bf5701ca38c3bd87c358b2b473f3b893cb7200223493125e842c37c6263205d27428f3b8b231bb01e5e35e73fd72ff76cd4e0da96f67e95f6abe7da33136cf6d2ff2859ffd09110d573cdf521cd2e9853f60eacd2bd636750d843d2188d21d1c2741087c77a5c1abf7cc9515d4648b17bf4f13e0c4fd689b1443e00ac43b8f2376925265a7ca10e017d3c4647fb8d69df7b9104d189ce2ca831ce0075d8933d50128457dc1c36cc1b16003216abf761b1e63407e7c952484b54758ab41e8687a6dff0d6d1fac0f29ca08a0aadf6f82b937d0c6b4272ce12096250b662fd28b1962f03342d7e902f862437c1571b3de55b58f154836cbad251622da38aa5cd1bc42ac327f6f25a68c671bf153bbac433aff530723e44a1ff1e48ef44ad224d0d73e660c0b3923a66a578cb3ad27a1750ee3db143704387e0d14408d66a96a4520338fa1a37db233bc80caa0ebe3a074b3036f06971afcff056838f21d12d0bdf90610c4a3a01fbcaa5c9d05cc7aa3388b6db30c8e5d87034a212de3351910cda531a5018063d2bc06c7c11b4451c3a455d838140e698b2d718653a4848585fefcce555d906618b03f0d77b691d6629bedeab5034d73baeab4c4bd42409e9c40f22ababaf2d6ed79b1016e56387ae23ba5b3899902c08ae17f50b12619f7d77e6d485f079d58e23e4d907f0970610fb6a90e86e36742183a7883f68de8d7824f28972a1898097acbb11e385dde5db7d4a7b7410507a7d20a15f624a9fc7aa8555e5a279f5e58333c0f4406b6870700b7704dca06fdf4929b0186290591e8c5ef8dc2910302f0cf56a2bfc62b49bf35c867623d6403610bff047e609031f9e6c573679cde25d260a9c250001539a63a5d14d15704d0c4575765d48d5b972d5a44b9abe59926d6fe04109c734fc5036f2f9660dae9626bc8939238f33e482d92381e08290cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: BLS12-381 12 pairs, affine preparation");
+    }
+    {
+        auto const input = parse_hex("0701301a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000042073eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff000000011a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaaa0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010108d201000000010000010c07fe385f42e94934e40436d83f43fe6b27526a3600d35efe4e95126e2753c2f4ebbc397e8e66735c12cf3deaa5c2671b01ed7f94783ff1aa813e53205cbe69cff94386d5ad71d6b0c54a651f1029e0ad7707c46808d512173dc24c909de5cb641869bbbfb6d3fb0fe33a29de5c16fee620d3fb00d8ac6d5f64ae5c970ac3909f39f6557decb9718c1a73509812c754130f1a46ff0d658546c1b4326138fac617af640a65f5a1097b5474d535eb24c48298739350cd75fdc57dd0189a2d6d8a5212e1b7ef06d313b2ea34e5f91452ba04dca9e20f3fb3675684152d24b3a6123e351a1699259d87f0a51e9890573f746e17a326bea73bb0e209cb75966470ddfd76c8916bc8c5f38fec929a43dfb19dc70722c407d72dcf87d7261cb2683f97bd079bd7b585b41d8b3bfaa265f9552a245e2a440634a17d16d38cf14c7df2c0757c4702e4bf8483533fa20d9f23a893570d8541ebd8fdf9e88ab2231e0b33e549028adcce3da789cfe10c9f37b9d9d61e1002df66e05a42ebc321fb7ee541df9f1637a10660a723a7f34e0c6a15567439d3f2d73d652276e266f098e32240cb7e76c8690f64558984669932384a69b6450a3db79fb11bc1cbe54209ab03aff2a84f123504803ed2c42efc2b456f067606bbf6af321efc1c2a617d7afc8ad78a8a07dd4290bf47ae2ae48dd93cf54e45370a2727676cae530e3162b889816b4c02cc91495ecbae348a7647f5454ff374ba01664477baf147966a839fdc2d3b31c85268fd14e81492e0651f5b64b649ede9269be89bc5b730381c9e51dd40a9311500d81959b2007e3427b6191530dbd74cd89ac93863cf37f4417defd82345167b783bfaf8d03a70d24b080630aeafd67e055ba19b7ffdf03842317734b45952008afa5ee34789acc838baea9ba2b33ab00c5569fa744a3e1f825ba847c64a193f15bf61a9d612b225990107c975c78dfdc36cae313662c3335e9102c3cf63f73b0105adfc2e991d3643113b1285f507490a6e05905017ac3c98a5ab8dfa7400939d480fb7046912d90fe79eb5a92d90e66ce087977fec402a6f13051390d0535207b4300bbb9e4506791c867c440af82007cdea2a668fba395d6fc6fb2af5e9d168d25733b656ac1b40e70f3520be9cac12de51c6b5064b369b56e580c3804ea4ee047d7c077fb7b0a25a1771912338e2697d9a72787b1143d54b8d623a62cd2f0e1953bfdf2fdc16870cc12318d10d4d7bea14997d171c1bc21f559b02744565c8654deda3aaaf5f540394ceb806fc8d026e05da90126b6b67f80bc70c1bb13e084d29054d8fa915458aa82f53cacaa7eef07ccfea28230f579f81448ec246a0035871149f9f775f930f13491b83ad7049da9d8a6f4045d31ed44f8de16464225e647b5a71d7d2496243ad9b695b09f4169c55a7a26b0bd336c24ff14ded028142bb7433373501d5c1b52492966cbde9dc373f20417783503203b6d327c2502a0b37fc87b3d20bde8cbf167588cc15b49a1e08ac62be0c5a54b92b45f78ce72bbc7024e0a05473911dfc8a3ba273bce51711ccd043ed84459e88ef248554470bbfef00f20dd4f2f367867d2e971745311ddf3909dfaf6520762adedefadcfde719b5905358ff28d5d69d65795b965fc225d33a53a6735764d3a4d32b24cb5d484b2d57ed35a62baa503805d6e883a01b129bb1a6db742c5c9e5a67f5c015685c9d62c23bd2d1f95e940a27d9cd8e0c09299abde5fa6f8b70249bbe6cd970cdda14c398193cc6baaaf0353c1e5497366082d9950efa047df2de9aeeded31b9fe76d1002e0f62fdb05868562c5f61ca1c3081f9a0b562b63794fad9b3464a067bc9f976cbf82109da6c551eaba885570bef01c5c91cf5911d09f2a23d27ff2cf68156175b4ac34f895aa84ef890dddc8dac57f48b961cc80f60953423e23f82b3c2968a0bc0fcab69d85f5f1e12d6ae2c318fd158436885358963232e825ea528778a82e05e45886b78a9bae6d26fd199df382adada0b6ed9e339ba7ec836fc22200571db77b63457cbe1e0e8ce789f87c78837db99743a1d78e8bd5012d8ef48d7dde7fcd53efc9cb0767a8fafd28f05d09c578ea5476a0247858c931d12761a815baac44376ef03d7382856ca622f82469f48f7ca277d723327704a1390272f805039069a2a83c6d3759b24c0e4b81233f6fb49929a69db31362127adb59064fd7f5992822e3a0f01880f2cbb55c6a7c0e0f1746a9397adff5cbe71193850c7c0acebcde2fff6f0d96313dbf2dfdaf5a1aaa3da1c76aa9ddecf5cdc023db8ef4126a771e1d1876c2119d1731107bc459b29935b3bc87e81faf475d70866c84d9d67623aa9a26490d3d7c268e103db83604dfd54217ee497f2c5e6a62b297733266ecfc6ae25e764b6c78958be35f5da79b1f42c535e580bb33dbc22cb4ea3f96083e535240e93e7fa575765dc9c13831aab729c8d2feb007a536e198ce53e3b7bad6454b081ca5902f96cad61701a3961772ba388dc7d09164afe85833886580e58aaff8b1a7dac8a770ddc2870aec2565fc6cb640902a2c1b67a99cdfe9ce290fbe5ff77b64f4a39d1c5329920b032eab94b9d397e1f2162daf6054005baa54f389eddef924c9b761bb20e45ec12de1168730c1e53429e867b23575d0673d6bf87ed7c156aebe0c8a0cc775701e8d53168027f18e714bd079af42e8825d62b905383c746ee828eab21b5271c6a6134d659976dc08706749fb5cefb7167aa9e3ab53bce47e186fbcf800dee934e7494617b22c99f4320b40a70aa591027a23127ac0f1273c128fcbe6b0921441d5d45a4a9c89461fa3ad4c7b803c5ce535fb1e19c38a85c183c73ed4df8e2f126032f65a73d4f7196106e9c9ab96c2107214ab3ffc90c9ebc1d16118e558fbede9fba50d170a313bff06a4a62f481c8c030926edd21a7c878f7a826d3514696f628c00ba7fa792feb527ba18a114c6d6f2880005583d79d549f7c0b860b30dda050deb96d8e640a2cb612a4a84a44b21940d6933284d4b58f7c29dd9a6ac42e7ba33de198a25421b613db54f08f527d1ed987995516e001714e487103824417dbdb200c7f91d18560b27b27f09c821b554991617a517158974d8e333dc2ddff524dd45c5ae76650cce15bb9aaa9f2714e41fdda366abf8294ab9342e464a808f39eaab137aa962a088664bc197e7923748307eae8c15b50ebac7dee28d7ca53dfeb3cc2ea48354dd2bce53faf697f660a1873c174cbded0e81b48ac525600763b6c594203a55457ca18ea8505a9c4d204e2d6bd011be6079c2bff562ac3e2cdc6cf04613ca403b91472cb4327762a26f457b2c6472a66b94b3e2796e5bd259049d7123a0d84ef02a05e8863d8e7b7f7262c7ce0604a619850d5a716ab1ff866de0839f040b1b11cb7397f0d8f6d9974ccf8554eb53b113019c242c5bea354506e46aff16cfa342ecac7cdf50ae10ffbca1147f8709177afe9cb71167a014959dfcd87a5b670f86a20cd55511a5d00617f77e00104dda0a9b1e7517905bff559e24581dbda0f15c7789aa1132c22a3a632852d6e02d93d6f07eaa586e064b780e98f9fa00b5c8851808bc2581d777125709af3bd8e85a8e828392490c39b7bcf1c2f714d6d585a3f5173c9aa86176c4d30470681444937f46da246fc9bc4df2c829b936f0bc1f9cbb23645f90eec922c0ab5e3b6ef573f12f1ddbace4c2ea9f62fb0a230c650dae2c925d93ea67359b28c58efbc6aac97c124992db0760532ae20f5d3f6bdf65a6741c252a3bb24eea2b6f6a2b05d6ef933d1383fe7e336ea835b0c2d28da46d405506b3d2b39bd5bce430546bf8f1f83a1605f67d1372f3206b78e59f05bb13a8aaaf706ede6a66ae382306a6084f1ab60ce0090996410dcc9568871b86eda65850df9204c31cfaefa06f7bd21943e1a58b395e73721e4fcdfbf33601b1b685817ded28dd4c99f5ff7fcb8bac8bd89e3129968c74f0662f6d28e705e30f28d325f584aac7bd9de30319f89773ec34f058c69e4987f81080678715ef29740682dc066119cac5efc52f36cce588186435acf675078d67a96a47e1b04f59ee0b55a16739129894ee3221c0a8e1467e7d99cf8c5499ea3fa3ae5fa5ca249712d30bd8f19326fd030a2bb2d487673a98866387b23a5050514dc668d75bbd11543e20ae6cb28da1d59bfef1ffb4f73e19334feea3cdfa5a4af9aadc9bc00de1454ae74e350c3aaa2873052bcf408166f5b3800a7be6fa7a86a9e7395030b1e51416dcc184bc6278ce454155819a2e0c0a77b7d149c9c8ec511123d0bd0221b6d75ce62fd8142c6c4ec64c6eceb6e9de13eeb014bb0f7976ac8e1347cbef4a0f63950e0f8aaf5112d95a82fa47935ca1e4d3a77c082e4ae75a070e04cbac4cef04d9e1504ee7eabd4731a2c491c21514acb5c4342a9ec8b416a50f330beeb5190eabd26acbb88ffa47c85bef411ba518126e0d4400a8c9bea9e13068af5a512eb785ad15cd8173e71c9bdb6b286e09b85739830c235106c85125ca84a572daf10832bf1ff0d659c4fcf4087fff2d3b1236c97ff57f00ea3d7c4b1b4bbb3b8ad7508bc7739d978df5fec9b4dc021d30960cf184d5f7e75a0739e8e2e56f01c64c42070dbc3a187e50980ec277514eb682c8b3f66db7b1be7a32a264223d8a781017bc086001f1b2025098d35c2eb22f927e7195c9cfd17c7ee4962478b13214eec5cd93c8d60fc5fd7fd7f85a63d75cef06f48a2c161e67eef872c3b92e1b78cd2b0ab0ab8c05448dfb3ca3a66d2bc9cdcabc30a95a3ab9e6e99c0b51d8374bdd1461da76f734d9ab6cc33c63fc7e174f8c84aaddd329ddeff0b2755ec4fd3ce14e711d4b9eb91244368e6bfbf793bb3d");
+        auto const output = parse_hex("00");
+        api_test(input, output, "Pairing: BLS12-381 12 pairs, affine preparation, off by one");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b6716600010101000c030c6e6cb02c7686d9ad1ab08463480ef9401ffe3addeb8fff09a94a6e8030994c33fb72fb7e016c653200ff3b9c08f9d7bae7c4c6fc2bb23ed0e06c09844080b6ac5d42de7bb742496e9147017466cb57ee50361571e251355c1e0f726a17e1a69de552b76e226a4eab09df18284f76da60039559980fb69ee62f2f57d37e75469305b42baf328cfb4d7699b648169f7f63e07fde56029702334c9d10c1f5b34ed39f586e7af2b3d3ea1077a71e0ad93bba19a59672685979ecf750173c01b7142b91a9ce2be30b5306aad15dbafbac6d4261d3c8ee1255fdef6618dbc0310886123bf902b4e0b36d14594ce299ca4d2daef07dcc3f7c4912d3c38e2f25d191ae945f828e45aab1b32a0378b27734503b4dcd789a5f9a33908cb8e157d1c974b349d4b1e51d336ee4235a3bbe4622860098ab84f76e333711646ee322a8fda873616173b928beb023c9db1ab88ad76907c6bb8675b001570159c4eac1ded3099fa1cde63ece4e52b8d322e0114a94c80cc99605aa759eb95183e94b039ee301474bdcf5cbcd5de07ba2c01a59e994836bcab662c7ff2d54af23ff94197def69ed470179b78e6b3021080d6833d52b030db190b324777f214016ce1ef5f6d121956e1dd6013e470001f8676b543d39072cfe450337015d6e760201306dfbb9d62f911387b365ac3ee19544d50026031763f7ed296b214a962e5fb566a2c149da94dc7335d994cac3690be91b64702f34a53c66e302b139838ea261fd98b9f6025159f292c43e8a24a14004c6653d560588d7b0a3f64e329988ec02a43d8411357efa608907228ff14d398b2ace7fc73edcd3bacef6bd2cf7e8c6285081ce5ffc02b7d96b0df4d70cee7aebdc7e5ed21e0cf01a66fb125770ada837f2e92f882d25c1c7af86e201e6382526227ef501c59309026700be756f50450ac9756720644c5441751635976d629288d802490cb1c9da1caf9a59ac44960d11c4ce4408d90589c784e42d16ce454988bc2ddcde92ee430144b6a6d81f6f37dea52dec0cbe11a72fc7fe4652d60976fc8dd5c0484b7a69328598ce538800b7024e55d17a5f39ed35e5cd55b627402f3eea086b12ae029a0ce8b4f713a47cbe77a1144103a849407d95f4de4244a6076fd05d8a55b46d8241c0a7eb8b168909ead7ae3fee8f66649c9101680630b3cf15cd6a35e1e5b2b9abeab37d83fd2c83fd282565da29fd81e8c102df8098d71403343e3b720ceb17468c33e5fb2e750c19f0deaa5dd3566dc9497d0191462f16c9da67ede4e603423009b9e1786b1a32faff56861e0116b8b369c893c8b3cba2b356f6f0bc642ae12610123e00bcae88214333acb25e215f48bf416805860c5a9496a2248a5aa7888d53c31e2cebba3eb7e700830ff037a4d420604b77f2094e957de9ebb9ebb1566f9c633f8db3dc3c4feee6af89e11426001f5e874a7a5f7a5636f8c51a728e63fc0b6baa3d2107a0fde1c3fa26c5f4fafc05066c2f3e001a7368565c5afa0b67bf9178f445583458b46bdd645e0cb65b0e39644d72aeb4b9fec845fe036461589eb9062615d004fd47de03823dab392bc364fd213e4b5d50488eaf355fdfd2fe5ff60029146fb55e7b0e96ee5010f89edf580938402157b12a434c9b924b2bcab2bdc61f28fb40c402cacd506a9611a1f3f90f6fc5e4185ceb7d0fb260b2fba611938949a7935b82e137bde30be4011b9f68ef6b2ad5f30eb17fd9979a7f4a164fbd106d4f3eb187e0d689cae77858c651aa5c690369b13d7ef0eb1913462750ec4b902c0b6db20d5cde48f4422cc632d08a9d1f1f7dbcbf06bd032a8ef06865ead3abce7900abc053e48584caf5ca2f27e5b55e0b6677df03134056aa04af5e0230ba04cc943f679389fa2e8da053ffa981d44c05b73eb73e6ee30bb5cd1420c8c6d5e239a700daf970735a7cfa64ec15aabecc106775eff97ded7f5a808a5ed274fe9de495b63cde85086901606cd9402bef40229bbc24e03ef87ac1c59d6611cd1b36f861998a501425df103f9fa69c420246cbf6e7688b17e635b28bd2af932f1fb61a707a00c0acca37c7998135a0580beaeb116a500169386bca32edd8be66e7b2123794020daa7378323cf2019a1adfdd314113f1c330f8e9aa8502fa5b8bdfe0f059d960757df6b802dc7a7a9a468074de9ead20a87eac31e488fe866570f2e30093af0589d90da356647ae1b8a0c53d9a80a8a6bb9ea39560c5fe9b03dafb17da6926e13b96027d07b30de52426f2c814552bad3f7c5b00a776a3c7c85cef47aa482e43c4e24188414ff410030f1ad4936b84e950db361f2668478c144e175970bd563fea59935457ed45c6037f90a06ef801f4412dc62156a5b314f1f0600f9ac4641c94c6cabddb6a3fb0f20b8f44e446c2825658fd8b02c77dd5047b72ce5b4a8fb990c7cdb098b08f1633bfd2e33a491119d108dd93f9572f67945d01d1444679275b3882f7ca9aee92b79c52d11bf60f4503bfe73fde36c2885987a325a169eb79022dce2cc4cbce6cecc83b46368ea3436e946ab826d6c08ae8074b32828ad2ac987043c7468d003bf328bfa2505368586424df470067f86164008e6473b7e47574993a435a48d51315cb07070237cdb3022173e655cc88e7c83d0ac9eb05a0344a0ca87b3593f1a240440f57cd2731d8308b02c915365bc967e3038632e0f04a010c42b85e08da6cdafec2ef849cac0234369ce995eb0a9703572cfba950e4a31fcbef0316dbec3172cbe219f260272649df6173ff95b8692b3c8a76a6ac03054896e50ebc3b05d469c833deda5439f8943020d32a266e07506749375a9ec7104a463c3600c79c7780907d9f85ecb25c997ca6aa013adfd2af465c39d0630d7e3c03001e62e438d0d994026ab9edd8f1f1076f74c8b6b0643b726650aecab3ca3c19cdd49fbaedb08fbc62bfc07ea245024ee310715b09387bbc100e47414c6ef6a07de43fe0a2abb28036eccb64547302f17bfc177f0203a852eb1a3396852fa2509acca1d2f08179ab233754347a239423316bbbcbbbcde3200ee70279de781246703a94e7c4122c1483bfb9b121ed569b46c9bfe7fcb1f1396a845db3d425d3b8038cbb1c44968609e603f4a4b4447b0d0d7cd163f66870d080694d51f182ffbddd919eea3a45028e5cae8992dbfa61bd3ad12082d397a224f095dc89f08c9bf3d98d25055b1701e2a10dfb2d02af8d341aeca7aa850cb2f11504772a74b3fe7893bc7ba87e4c78fe4b61d13a4ef86bbe6d8601e9802434385a3cad2d325d7537d2f0743ea761142384263e2738c4e9e244881712e06d326b020924f7d749bc69ee7dcf3c4f1df1e2054ee91fb7015185531ecd9935f3ae95cf7d9972a7fb026d1061c3bbf354984b6a3ff891624ea7c2e00c4339e5e5674a1ee5bfd86cb49bd5ae2df4ca01511cce810e3433d98c30747e8843ef98f17bd22b83c87472b8d5c4bd85c293b525326e426d015f061fadda6f2d515cd6e244b3ae8679d1250fb3382b3be019d4bd797acb1b2039c67fa8bc0059758b8f2d4719404857d21b2dbd66527bd0fbbeaea8aa9eee83da38e9e5ab126c192805b700045a3942df359019ad1ba5bec6d90254d3ce9e4f9544506b17a5fd0bcfff217830d9a6bafb014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: MNT4-298 12 pairs, affine preparation");
+    }
+    {
+        auto const input = parse_hex("07032603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a71660001000000000000000000000000000000000000000000000000000000000000000000000000000203545a27639415585ea4d523234fc3edd2a2070a085c7b980f4e9cd21a515d4b0ef528ec0fd52603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a4000000010000000000000000000000000000000000000000000000000000000000000000000000000011131eef5546609756bec2a33f0dc9a1b67166000000131eef5546609756bec2a33f0dc9a1b6716600010101000c0225f3ad98672138a14c075e60d0ec6be2662b2e2fd38c558f64d0d5625dc3d2e4c6042285dd007127e05a0ab07ac127d6b1e2d98f7d04acf715bdb06824fa41f6da97512401af46d4752dc30380bb3984aaeb0ca567c9cf453eebf8744af61edf530095bea9f2b5fb9451b39783ed99d9180332e633034bd1f8c0580501ab0f23bb4d851b30e931a52eddf52ab8c77a68d8d3b0ac19ab5d01677ce20d97572604287cfa8248d4a9265f23a24275b0bc8e0a525e2d004a726820d329e45a00f3c5f7be153a50ee7ea0d8663351c94c8bc2a74bfce6ca6066147c2b3706f4b8d807419a8102a2f20e15ba78fb9f96d4d6cbbce8f3065b275cb211932028a193b79269fbe1956c7c409bcc033103fc63bdd320bb44d8012aec6c3efc57ef0f00c65db261557b4a47c0fe51711cc19018ec035884f3ff4a41acab1b017aa2f88db7b8282e8c0e894916ed0c310814888ddc6916f170b4d600c16a8ba01d3dd42afa3ff91af831919a06731ae42572224a76fcb04aa68b0dd3dcde127319023857ba6652a9a152abfc83e4ad06a448596da97a681cda27fd8258809126dd0e29c62a518201c16432978860b94856fe6c74f161f49d5d3192782f400e53292f891ce2641591d08e88a034030313c3fb3405d656ee3b6c66976258a4055686731bc6bfda48823ea31190bc27f22bf6719c0322184805d321ecfce6bdd4d8b8ae1afc957526955019a172ce7a993a2305b2570ee44254110230386e4ace4e95ae6db0ddd5703ec00359e8e46709b0748ab87e86ea68617b1f2a2033da7802d173c9b162e6757a8c958541d6c2a01a069569f14fc63f7b00a30f8357f52fa02e389485bc019bdba48f650ecc80f1ba3d995abb64602cead3e45c6d1647c912bc89d3c0b9df73537504a203635e844dfaf1eb02c960c84d40b2a5b1b6c3e83a29ef44edce40ff9ea6c595693a7b147949003d5f0cff4a7e69c4827f8dd6ddb80594552d6a8f2e95b3aa09722748481f484fb2350b438800e04a0c7f04ddd787f405a958bccef5294bc7a391953f1665531952f81673f9942f807342b60034ae5ef84f9e4c5d2877c16ebe2786367db5fbd2dad0ffabb3d88e71f1083231b90aedc15c02f01cd0fbd9206007f3eb5e3301aa326aef3066d030e55f0b880befd2090fdd927e2e6429e701c3198394570bd42942efc768c673e8e86d38401a04a253b60b98c6c39cd5875d916db7747a033fc4914ce49d9ec9330bafc5e633f7d0bf0c305d7c538d657e8a5fdc473b911511fcaeefe400b185dbe1cd431cdaa69fcf6e9796ae3a0a6b384a7f7146f0de58d579bb104f9544a87d1d7c00b85a77601df84ab0eb73e9b5e7f079deef80c13ace085a532efccd52293843dc311e487fb302c8cb8c4f9196dc410e248212652fadb5c519ee26706bc6abd6ce3a17c1d5d40c170128e772029fb44544d0437b46db0b7edf761f8e2da94ea4c5bd0c369d2adc6054c714b368f72737976203175d6c131452011cbc78c061f01d4e1ec8dfcfacd4ecb8ae7bf550d4b1b285a777a88c519701c0138ed3438655b8322c9ef7b8966587ef34a6b24446d4470dd346067d660756b99a0b6fb2013909bfbfc314ae66445cce574bc96a9fd04736f6294701de554af93bfa8b36bc26b7b97bcd00d98ceee7ec83a2c1f18f34da7f79908a73facd54704892431e4144333c0072ce8df5c9f3100145f2e09633d2bfe82f1e11665afd16f749ccaa69c67830ab54d875b0b4eacecfcf6dcbf55603075b0c70d4e9482bfe945dd0dddc0e63b7aa0a7174100d5f284a1e7045cfa819babf3d1f8d014a1764a70cfc241db704c50620eeddd7e867ec65f0ccd0bb1dd2044c102caf52e9f65ec5800216957de9552c3a2d02322d8ca72ba3646ac0d6f7bbff8bbc54e60bfe9ae8d1122846865d9d017867f9baacaa8d2ce1ada3bd3b564d41db01a11ffc57e75edd7af9d833e74fec0aac3ec9e40251baabad5728bdf8d2d6e9fa3865406383a254af361def33984e86e527b1c3f8d01654baf4022e8f1f2b84a3efa890d1176a166b6b7beb79aa6d6b9d5c6cfdb1a0c8b233fd5ea4065728d402664c41be9e7e49fdca50ed6db6159a541e7523198902a11df5b960ff104f20e98d4c6bc294007f712e69420ea46a1b64fc06fe74df5398197bad33273d7a7ca58cad799e4e8f46e0b4902e02eab34d8191549eee3fe8676747375b6bf40462a454e3f2b714167bb2fafd0b55c2e82db5220367a0b6a2e347b1d1adfbb784c7c6d6722b7ab79cb5556c6fe306a37d5e6448e73b1f5e287e016d15b3d2dad2ce921d675456dd51ea0d3d18405445053cd1ad5990d1068a1db0768ec7a1cf021904fa7ba181088284ce8fc582131811448e76fd28e5f25feb88d139d5062fd1f787a63633007737fa49f85fd6ca86ad36ae74267d6b69b3b8254cb1306ff65569a0c4b895f1a5febac31400446a7c641a2ee4d8c11f05491438fb04b83ee1f5d78bba1ee1ef98cd71544499978be32aee03a34a02a303fcb470c5cf87ffced7bf1ee1b0ae5571ad790f6138b2b30b745a5bbe649f0fdd02e2fcbf15bc3e3b47c814dc85d5bab9865cb4e174b5df3ae88e1f0947227e4b0037ec9a61600315edd5b116f0dc7aa80b7381d1e005a10b0b05c1ce60fdc37f9109a48abf68fb598dd466ab03a71d42ab050c788265e63591158cbd5cd0d735f0043ed51ca11110fdbbe8d2da8072ae12ad000e6495a3a3a5787895399582b4ae67723a5e26c78cefd0f10a40d1d6e0134127305f25a294038e20fcb0cf54e30b14dbb9e16cbc5940e6d6958b4016d94f957500be42e8fea29e0003b67f0344360d9d153e878154a2e6b65f9233228dbf9e31f17c3353aacc7602bf02835561eb7d32c301e68622256ed18e06972261a189b5aada4fac95cc13920147d661ac9ce90249413cd3e3d44300bc0f1fee0071548405ff037aeb51e15949e6ac3adf61ad4afc13b9a2d29117cb76f693081c02e51d1db6ffc45818bb2e2d45f40596bf8a604d7f006011237ac3617529405e9e53c3074bc50008af651f7af26402c6c91fbba3c62cafa2dcc214280a3b140c28c7a30be5e3d6014a990b2301696df71e89def531c2df5e322c7ae310dfc4af7be3a9dcb17487e441a485c4a5f790e11c0b035d12b41f78bd653f39b7a02dea2dd22d63f90b29e4657f9ba29d26ce06db88e53f5807470701c2ddac3e3436047b17f2f77dc839d3ea045f882b82aa09a9cd8003c662d6d01d4fbc8608020294cba55ebde68dafec8bfa4db65504d0b22cc124139d880602a93813c87ab01fc66efff29d0239b7d37297a232ee3b860da70fecd39f54ae1d6d07454bd185addaa612076a916da447783903828996904bf64871c26ac1c5dfb67606ded5e96914b8ae95e44b67a4e960e59c2bc063c028021443e1ffb500bbe022714522c94e4edc3e80319aaf32d1bd98b9e7b606bb6bb8f9552972e002fdcc63d118b29f548288f433e58a8ecfd359f362a4a7307f94ce61953b16e68ff284094e44020806f0628cd54ab3cd3fd5a8cbe5085a37648598343286aa799f81dc4f2ee8c966b4b00ace00f545237a75ae6b54a91d258ea336fc49f486c89ab6ecc10a13a591abd1ad026e766f986d0b014baab723a2d27e6e91d69be1d18308e8f7528ae6bdeb761d6156694a498cf17b6df873a2a300ad150bc122a2ad6a416530df7a4923a8ff0abfcf31bfd0fdbe0a849a33050d3c3e6d2f64260220c949bf076da138c1212dd889b967384dfb3efe0bd2696eea1c745030452fdbded34afb4a02968e9c3234ce90db1dc3c54c5a1a20d0bc75c8ac6a75878dce0ed65a3a9441be77e790d749");
+        auto const output = parse_hex("00");
+        api_test(input, output, "Pairing: MNT4-298 12 pairs, affine preparation, off by one");
+    }
+    {
+        auto const input = parse_hex("07042603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a400000001000000000000000000000000000000000000000000000000000000000000000000000000000b00d68c7b1dc5dd042e957b71c44d3d6c24e683fc09b420b1a2d263fde47ddba59463d0c652822603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a716600010000000000000000000000000000000000000000000000000000000000000000000000000005131eef5546609756bec2a33f0dc9a1b67166000001131eef5546609756bec2a33f0dc9a1b6716600000101010203b4ca8db97a8f9459fe15dd137021fac04935617ccc2839632613f05ad4d91f8e35435d140903204ebcfc319c72b3101453a7185ccbd13de473c70550a39961b9eb8dab4dde0573a1f0e79200e62c9ebca4ab7b651f1840297862cc9d6f8382216c1455a4a41ce8c71019f859592fe3b8f70061815484cf8ce7299760b26b9f7cfea5ab3dcad042ccca4b29b4cf4e787eb08a341c3969160110613d4fb976f329badf9321b1aa7f723a3b15931f57115de0dfc86d399cf6478e5052683002032a374381b545db736ac2238c2aa74660d955c216ccb2be1a739e3cd9a727e7ff5d478339020570d5fa2f49ca81b2328215c69186ec4bea4a728ed63c0f6ec339f283219e9128841009f900e38ff9552a441bdf1ac3c19be475f80598724f8519229f58fe20e591544997afb07b9dc9640060892f902bd23f0824128b2f330c5c7fd0a6a3a4506513270e269e0d37f2a74de452e6b43801fe77da315f4d74e9f8f1215e276dd8fb8c5ae1b3bf4a950be20f6cc435be16b13ddcdb86c003908eaf97fd848231b8f9a01b1f2dd31869350ba196fab007c6c1632c9f7ede71c0022864a30009b814ace061a735f1ede0514a89b684561fc55da7baa7f5b6a6e7a5039adb48e44d5b827a02ab0e916791658486071d5c892340e2beee64f7a34c4927abdf50ccaf724d2dde1bc0cbfce8036a7ed8df72a66d7fc524e4ee06c868988dda784561bf2b1305418ee30ca0e0cd4a901a064501a59a0e8d70b6476f24df2262030c7f420fc57bd049d1a6661674cbcb0e1e0c50ee76a5ef59016055ccee1ae7521d49dcb474e1a7f17f50da857497a23a97d2c30128a21af8b75e3faf2407");
+        auto const output = parse_hex("01");
+        api_test(input, output, "Pairing: MNT6-298 bilinearity, 2 pairs");
+    }
+    {
+        auto const input = parse_hex("07042603bcf7bcd473a266249da7b0548ecaeec9635cf44194fb494c07925d6ad3bb4334a400000001000000000000000000000000000000000000000000000000000000000000000000000000000b00d68c7b1dc5dd042e957b71c44d3d6c24e683fc09b420b1a2d263fde47ddba59463d0c652822603bcf7bcd473a266249da7b0548ecaeec9635d1330ea41a9e35e51200e12c90cd65a716600010000000000000000000000000000000000000000000000000000000000000000000000000005131eef5546609756bec2a33f0dc9a1b67166000001131eef5546609756bec2a33f0dc9a1b6716600000101010303b4ca8db97a8f9459fe15dd137021fac04935617ccc2839632613f05ad4d91f8e35435d140903204ebcfc319c72b3101453a7185ccbd13de473c70550a39961b9eb8dab4dde0573a1f0e79200e62c9ebca4ab7b651f1840297862cc9d6f8382216c1455a4a41ce8c71019f859592fe3b8f70061815484cf8ce7299760b26b9f7cfea5ab3dcad042ccca4b29b4cf4e787eb08a341c3969160110613d4fb976f329badf9321b1aa7f723a3b15931f57115de0dfc86d399cf6478e5052683002032a374381b545db736ac2238c2aa74660d955c216ccb2be1a739e3cd9a727e7ff5d478339020570d5fa2f49ca81b2328215c69186ec4bea4a728ed63c0f6ec339f283219e9128841009f900e38ff9552a441bdf1ac3c19be475f80598724f8519229f58fe20e591544997afb07b9dc9640060892f902bd23f0824128b2f330c5c7fd0a6a3a4506513270e269e0d37f2a74de452e6b43801fe77da315f4d74e9f8f1215e276dd8fb8c5ae1b3bf4a950be20f6cc435be16b13ddcdb86c003908eaf97fd848231b8f9a01b1f2dd31869350ba196fab007c6c1632c9f7ede71c0022864a30009b814ace061a735f1ede0514a89b684561fc55da7baa7f5b6a6e7a5039adb48e44d5b827a02ab0e916791658486071d5c892340e2beee64f7a34c4927abdf50ccaf724d2dde1bc0cbfce8036a7ed8df72a66d7fc524e4ee06c868988dda784561bf2b1305418ee30ca0e0cd4a901a064501a59a0e8d70b6476f24df2262030c7f420fc57bd049d1a6661674cbcb0e1e0c50ee76a5ef59016055ccee1ae7521d49dcb474e1a7f17f50da857497a23a97d2c30128a21af8b75e3faf24070060892f902bd23f0824128b2f330c5c7fd0a6a3a4506513270e269e0d37f2a74de452e6b43801be7fe2a31454f13aa4b68ef6675d15cdd702128dd5b0b4402582f0a69dfd2c83662324794100e62c9ebca4ab7b651f1840297862cc9d6f8382216c1455a4a41ce8c71019f859592fe3b8f70061815484cf8ce7299760b26b9f7cfea5ab3dcad042ccca4b29b4cf4e787eb08a341c3969160110613d4fb976f329badf9321b1aa7f723a3b15931f57115de0dfc86d399cf6478e5052683002032a374381b545db736ac2238c2aa74660d955c216ccb2be1a739e3cd9a727e7ff5d478339020570d5fa2f49ca81b2328215c69186ec4bea4a728ed63c0f6ec339f283219e9128841009f900e38ff9552a441bdf1ac3c19be475f80598724f8519229f58fe20e591544997afb07b9dc964");
+        auto const output = parse_hex("00");
+        api_test(input, output, "Pairing: MNT6-298 3 pairs, product not one");
+    }
+    {
+        auto const input = parse_hex("011cffffffffffffffffffffffffffffffff000000000000000000000001fffffffffffffffffffffffffffffffefffffffffffffffffffffffeb4050a850c04b3abf54132565044b0b7d7bfd8ba270b39432355ffb41cffffffffffffffffffffffffffff16a2e0b8f03e13dd29455c5c2a3d9f8da39002b5824a4814979f383693ab9c72682288fb71a51f8c0ae38c94f444cbb38177522ba9f3163372ff29c4e8afe28cb34b434f195e18756c65114dc96afddbd3374592813b0e63b635d643d50032ad9b890b1b61fb74e842ac8f3a45d840b0f0185a5fc475dd731d1b40b38a9e");
+        auto const output = parse_hex("ba4d9af538bdceeb88d8946678d19a4c1eebe8b6571b56cd1602f74349d2eb7026f5bafa93a3f4f092284283a5c19158d174bea958b9cbeb");
+        api_test(input, output, "G1 addition: P-224, modulus shorter than its limbs");
+    }
+    {
+        auto const input = parse_hex("021cffffffffffffffffffffffffffffffff000000000000000000000001fffffffffffffffffffffffffffffffefffffffffffffffffffffffeb4050a850c04b3abf54132565044b0b7d7bfd8ba270b39432355ffb41cffffffffffffffffffffffffffff16a2e0b8f03e13dd29455c5c2a3d9f8da39002b5824a4814979f383693ab9c72682288fb71a51f8c0ae38c94f444cbb38177522ba9f3163372ff29c4e8afe28cb34b434f195e8b4001ff406f935353fa1efdfcdbcaff065e9ed721b63c7487408289");
+        auto const output = parse_hex("5135da93e7eb9e6f47fe3c8dafd0879ef0a7aefa121ffeb884e361a3d4dcacccd782eddf517f58da59d90f53f6edbf78be104d633e545208");
+        api_test(input, output, "G1 multiplication: P-224, modulus shorter than its limbs");
+    }
 }
 
 int main()
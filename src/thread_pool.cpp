@@ -0,0 +1,125 @@
+#include "thread_pool.h"
+#include <atomic>
+#include <exception>
+#include <memory>
+
+ThreadPool::ThreadPool(usize n_workers) : stopping(false)
+{
+    for (usize i = 0; i < n_workers; i++)
+    {
+        workers.push_back(std::thread([this]() { work(); }));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    has_tasks.notify_all();
+    for (auto it = workers.begin(); it != workers.end(); it++)
+    {
+        it->join();
+    }
+}
+
+ThreadPool &ThreadPool::global()
+{
+    auto const hardware_threads = std::thread::hardware_concurrency();
+    static ThreadPool pool(hardware_threads > 1 ? hardware_threads - 1 : 0);
+
+    return pool;
+}
+
+usize ThreadPool::threads() const
+{
+    return workers.size() + 1;
+}
+
+void ThreadPool::work()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            has_tasks.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+            {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallel_for(usize n, std::function<void(usize)> const &f)
+{
+    if (n == 1 || workers.empty())
+    {
+        for (usize i = 0; i < n; i++)
+        {
+            f(i);
+        }
+        return;
+    }
+
+    struct Job
+    {
+        std::atomic<usize> next;
+        usize done;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto const job = std::make_shared<Job>();
+    job->next = 0;
+    job->done = 0;
+
+    // Helpers that start after all indexes are taken return without touching f
+    auto const run = [job, n, &f]() {
+        for (auto i = job->next++; i < n; i = job->next++)
+        {
+            std::exception_ptr error;
+            try
+            {
+                f(i);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::unique_lock<std::mutex> lock(job->mutex);
+            if (error && !job->error)
+            {
+                job->error = error;
+            }
+            if (++job->done == n)
+            {
+                job->finished.notify_all();
+            }
+        }
+    };
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (usize i = 1; i < min(n, threads()); i++)
+        {
+            tasks.push_back(run);
+        }
+    }
+    has_tasks.notify_all();
+
+    run();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&job, n]() { return job->done == n; });
+    if (job->error)
+    {
+        std::rethrow_exception(job->error);
+    }
+}
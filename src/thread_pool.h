@@ -0,0 +1,38 @@
+#ifndef H_THREAD_POOL
+#define H_THREAD_POOL
+
+#include "common.h"
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+
+// Fixed set of worker threads shared by all operations.
+// Calling thread takes part in the work, so nested use can't deadlock.
+class ThreadPool
+{
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable has_tasks;
+    bool stopping;
+
+    ThreadPool(usize n_workers);
+
+    void work();
+
+public:
+    ~ThreadPool();
+
+    // Pool with a worker for every hardware thread except the calling one.
+    static ThreadPool &global();
+
+    usize threads() const;
+
+    // Runs f(0), ..., f(n - 1), returns after all of them are done.
+    // First exception thrown by f is rethrown in the calling thread.
+    void parallel_for(usize n, std::function<void(usize)> const &f);
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef H_WINDOW_TABLE
+#define H_WINDOW_TABLE
+
+#include "common.h"
+
+// Generated by bin/calibrate, rerun it on the target machine to regenerate.
+
+static const usize CALIBRATED_MAX_LIMBS = 16;
+static const usize CALIBRATED_MAX_DEGREE = 3;
+static const usize CALIBRATED_PAIRS_COUNT = 7;
+
+// Rows are for up to this many pairs, the last one also for more
+static const usize CALIBRATED_PAIRS[CALIBRATED_PAIRS_COUNT] = {4, 8, 16, 32, 64, 128, 256};
+
+// Pippenger window width by limbs, extension degree and row of pairs, 0 where not calibrated
+static const u8 CALIBRATED_WINDOWS[CALIBRATED_MAX_LIMBS + 1][CALIBRATED_MAX_DEGREE + 1][CALIBRATED_PAIRS_COUNT] = {
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {3, 3, 3, 3, 4, 5, 5}, {2, 2, 2, 3, 4, 4, 5}, {2, 3, 3, 3, 4, 5, 5}},
+    {{0, 0, 0, 0, 0, 0, 0}, {2, 3, 3, 3, 4, 5, 5}, {2, 3, 3, 3, 4, 4, 5}, {2, 2, 2, 3, 4, 4, 5}},
+    {{0, 0, 0, 0, 0, 0, 0}, {2, 3, 3, 3, 4, 4, 6}, {2, 3, 3, 3, 3, 5, 6}, {2, 3, 3, 3, 4, 5, 5}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {2, 3, 3, 4, 4, 4, 6}, {2, 3, 3, 3, 3, 5, 5}, {2, 3, 3, 4, 4, 5, 6}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+    {{0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0}},
+};
+
+#endif
@@ -0,0 +1,331 @@
+// Measures the fastest Pippenger window widths on this machine and prints them as src/window_table.h:
+//     bin/calibrate [limbs...] > src/window_table.h
+// Without arguments all limb counts are calibrated, otherwise the others keep their current entries.
+
+#include "common.h"
+#include "multiexp.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <limits>
+
+static const u32 MIN_CALIBRATED_WINDOW = 2;
+static const u32 MAX_CALIBRATED_WINDOW = 16;
+
+// Every width is timed this many times and the median run counts.
+static const usize CALIBRATION_RUNS = 15;
+
+typedef std::array<std::array<std::array<u8, CALIBRATED_PAIRS_COUNT>, CALIBRATED_MAX_DEGREE + 1>, CALIBRATED_MAX_LIMBS + 1> WindowTable;
+
+std::mt19937_64 rng(1962);
+
+// ****************************** RANDOM FIELDS ***************************** //
+
+// Prime of 64N - 2 bits that is 7 mod 12, so -1 is a non-square and there are non-cubes.
+template <usize N>
+Repr<N> random_prime()
+{
+    Repr<N> const twelve = {12};
+    Repr<N> const one = {1};
+    while (true)
+    {
+        Repr<N> p;
+        for (auto it = p.begin(); it != p.end(); it++)
+        {
+            *it = rng();
+        }
+        p[N - 1] = (p[N - 1] >> 3) | (u64(1) << 61);
+        if ((p % twelve)[0] != 7)
+        {
+            continue;
+        }
+
+        // Fermat test is enough for timing
+        PrimeField<N> const field(p);
+        Repr<N> const two = {2};
+        auto const power = Fp<N>::from_repr(two, field).pow(cbn::subtract_ignore_carry(p, one));
+        if (power == Fp<N>::one(field))
+        {
+            return p;
+        }
+    }
+}
+
+template <usize N>
+Fp<N> random_element(PrimeField<N> const &field)
+{
+    auto const p = field.mod();
+    Repr<N> r;
+    for (auto it = r.begin(); it != r.end(); it++)
+    {
+        *it = rng();
+    }
+    r[N - 1] %= p[N - 1];
+
+    return Fp<N>::from_repr(r, field);
+}
+
+template <usize N>
+Fp2<N> random_element(FieldExtension2<N> const &field)
+{
+    PrimeField<N> const &base = field;
+    return Fp2<N>(random_element(base), random_element(base), field);
+}
+
+template <usize N>
+Fp3<N> random_element(FieldExtension3<N> const &field)
+{
+    PrimeField<N> const &base = field;
+    return Fp3<N>(random_element(base), random_element(base), random_element(base), field);
+}
+
+// ****************************** CALIBRATION ***************************** //
+
+// Times every window width for every row of pairs on the curve y^2 = x^3 + b through a random point.
+template <class E, class C>
+void calibrate_extension(C const &context, usize limbs, usize degree, WindowTable &table)
+{
+    auto const x = random_element(context);
+    auto const y = random_element(context);
+    auto b = y;
+    b.square();
+    auto x3 = x;
+    x3.square();
+    x3.mul(x);
+    b.sub(x3);
+
+    // Scalars as long as the field
+    std::vector<u64> order(limbs, std::numeric_limits<u64>::max());
+    order.back() >>= 2;
+    WeierstrassCurve<E> const wc(E::zero(context), b, order, limbs * sizeof(u64));
+
+    auto const base = CurvePoint<E>(x, y);
+    auto p = base;
+    std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> pairs;
+    for (usize i = 0; i < CALIBRATED_PAIRS[CALIBRATED_PAIRS_COUNT - 1]; i++)
+    {
+        std::vector<u64> scalar;
+        for (usize k = 0; k < limbs; k++)
+        {
+            scalar.push_back(rng());
+        }
+        scalar.back() >>= 2;
+        pairs.push_back(std::tuple(p, scalar));
+
+        p.mul2(wc);
+        p.add(base, wc, context);
+    }
+
+    // Time of every width against the fastest one, by row of pairs, none for widths not timed
+    auto const none = std::numeric_limits<double>::max();
+    std::vector<std::vector<double>> slowdowns;
+    for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+    {
+        std::vector<std::tuple<CurvePoint<E>, std::vector<u64>>> const row(pairs.cbegin(), pairs.cbegin() + CALIBRATED_PAIRS[k]);
+
+        // Widths are timed in turns, so that a slow spell of the machine hits all of them
+        std::vector<std::vector<double>> runs(MAX_CALIBRATED_WINDOW + 1);
+        auto max_c = MAX_CALIBRATED_WINDOW;
+        for (usize run = 0; run < CALIBRATION_RUNS; run++)
+        {
+            for (u32 c = MIN_CALIBRATED_WINDOW; c <= max_c; c++)
+            {
+                auto const start = std::chrono::steady_clock::now();
+                auto const r = peepinger_with_window(row, c, wc, context);
+                UNUSED(r);
+                runs[c].push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+                // Summing up buckets only gets slower with wider windows
+                if (run == 0 && runs[c][0] > 2 * runs[MIN_CALIBRATED_WINDOW][0])
+                {
+                    max_c = c;
+                    break;
+                }
+            }
+        }
+
+        std::vector<double> times(MAX_CALIBRATED_WINDOW + 1, none);
+        for (u32 c = MIN_CALIBRATED_WINDOW; c <= max_c; c++)
+        {
+            std::sort(runs[c].begin(), runs[c].end());
+            times[c] = runs[c][runs[c].size() / 2];
+        }
+        auto const fastest = *std::min_element(times.cbegin(), times.cend());
+        for (u32 c = MIN_CALIBRATED_WINDOW; c <= max_c; c++)
+        {
+            times[c] /= fastest;
+        }
+        slowdowns.push_back(times);
+    }
+
+    // Widths never shrink with more pairs, so rows get the non-decreasing widths with the least
+    // total slowdown, which evens out rows where neighbouring widths are within noise.
+    // least[k][c] is the least total slowdown of rows up to k with width c at row k,
+    // from[k][c] the width at row k - 1 it comes from.
+    std::vector<std::vector<double>> least(CALIBRATED_PAIRS_COUNT, std::vector<double>(MAX_CALIBRATED_WINDOW + 1, none));
+    std::vector<std::vector<u32>> from(CALIBRATED_PAIRS_COUNT, std::vector<u32>(MAX_CALIBRATED_WINDOW + 1, 0));
+    for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+    {
+        auto best_before = k == 0 ? 0.0 : none;
+        u32 best_width = 0;
+        for (u32 c = MIN_CALIBRATED_WINDOW; c <= MAX_CALIBRATED_WINDOW; c++)
+        {
+            if (k > 0 && least[k - 1][c] < best_before)
+            {
+                best_before = least[k - 1][c];
+                best_width = c;
+            }
+            if (best_before != none && slowdowns[k][c] != none)
+            {
+                least[k][c] = best_before + slowdowns[k][c];
+                from[k][c] = best_width;
+            }
+        }
+    }
+
+    u32 c = std::min_element(least.back().cbegin(), least.back().cend()) - least.back().cbegin();
+    for (usize k = CALIBRATED_PAIRS_COUNT; k-- > 0;)
+    {
+        table[limbs][degree][k] = c;
+        std::cerr << limbs << " limbs, degree " << degree << ", " << CALIBRATED_PAIRS[k] << " pairs: " << c << " bits" << std::endl;
+        c = from[k][c];
+    }
+}
+
+template <usize N>
+void calibrate_limbs(WindowTable &table)
+{
+    PrimeField<N> const field(random_prime<N>());
+    calibrate_extension<Fp<N>>(field, N, 1, table);
+
+    Fp<N> minus_one = Fp<N>::one(field);
+    minus_one.negate();
+    FieldExtension2<N> const extension2(minus_one, field);
+    calibrate_extension<Fp2<N>>(extension2, N, 2, table);
+
+    for (u64 n = 2;; n++)
+    {
+        Repr<N> const repr = {n};
+        auto const non_residue = Fp<N>::from_repr(repr, field);
+        if (non_residue.is_non_nth_root(3))
+        {
+            FieldExtension3<N> const extension3(non_residue, field);
+            calibrate_extension<Fp3<N>>(extension3, N, 3, table);
+            break;
+        }
+    }
+}
+
+void calibrate(usize limbs, WindowTable &table)
+{
+    switch (limbs)
+    {
+    case 4:
+        return calibrate_limbs<4>(table);
+    case 5:
+        return calibrate_limbs<5>(table);
+    case 6:
+        return calibrate_limbs<6>(table);
+    case 7:
+        return calibrate_limbs<7>(table);
+    case 8:
+        return calibrate_limbs<8>(table);
+    case 9:
+        return calibrate_limbs<9>(table);
+    case 10:
+        return calibrate_limbs<10>(table);
+    case 11:
+        return calibrate_limbs<11>(table);
+    case 12:
+        return calibrate_limbs<12>(table);
+    case 13:
+        return calibrate_limbs<13>(table);
+    case 14:
+        return calibrate_limbs<14>(table);
+    case 15:
+        return calibrate_limbs<15>(table);
+    case 16:
+        return calibrate_limbs<16>(table);
+
+    default:
+        std::cerr << "Limb count must be from 4 to 16: " << limbs << std::endl;
+        exit(1);
+    }
+}
+
+// ****************************** OUTPUT ***************************** //
+
+void print_table(WindowTable const &table)
+{
+    std::cout << "#ifndef H_WINDOW_TABLE" << std::endl
+              << "#define H_WINDOW_TABLE" << std::endl
+              << std::endl
+              << "#include \"common.h\"" << std::endl
+              << std::endl
+              << "// Generated by bin/calibrate, rerun it on the target machine to regenerate." << std::endl
+              << std::endl
+              << "static const usize CALIBRATED_MAX_LIMBS = " << CALIBRATED_MAX_LIMBS << ";" << std::endl
+              << "static const usize CALIBRATED_MAX_DEGREE = " << CALIBRATED_MAX_DEGREE << ";" << std::endl
+              << "static const usize CALIBRATED_PAIRS_COUNT = " << CALIBRATED_PAIRS_COUNT << ";" << std::endl
+              << std::endl
+              << "// Rows are for up to this many pairs, the last one also for more" << std::endl
+              << "static const usize CALIBRATED_PAIRS[CALIBRATED_PAIRS_COUNT] = {";
+    for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+    {
+        std::cout << (k == 0 ? "" : ", ") << CALIBRATED_PAIRS[k];
+    }
+    std::cout << "};" << std::endl
+              << std::endl
+              << "// Pippenger window width by limbs, extension degree and row of pairs, 0 where not calibrated" << std::endl
+              << "static const u8 CALIBRATED_WINDOWS[CALIBRATED_MAX_LIMBS + 1][CALIBRATED_MAX_DEGREE + 1][CALIBRATED_PAIRS_COUNT] = {" << std::endl;
+    for (usize limbs = 0; limbs <= CALIBRATED_MAX_LIMBS; limbs++)
+    {
+        std::cout << "    {";
+        for (usize degree = 0; degree <= CALIBRATED_MAX_DEGREE; degree++)
+        {
+            std::cout << (degree == 0 ? "{" : ", {");
+            for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+            {
+                std::cout << (k == 0 ? "" : ", ") << u32(table[limbs][degree][k]);
+            }
+            std::cout << "}";
+        }
+        std::cout << "}," << std::endl;
+    }
+    std::cout << "};" << std::endl
+              << std::endl
+              << "#endif" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    WindowTable table;
+    for (usize limbs = 0; limbs <= CALIBRATED_MAX_LIMBS; limbs++)
+    {
+        for (usize degree = 0; degree <= CALIBRATED_MAX_DEGREE; degree++)
+        {
+            for (usize k = 0; k < CALIBRATED_PAIRS_COUNT; k++)
+            {
+                table[limbs][degree][k] = CALIBRATED_WINDOWS[limbs][degree][k];
+            }
+        }
+    }
+
+    if (argc > 1)
+    {
+        for (auto i = 1; i < argc; i++)
+        {
+            calibrate(std::stoul(argv[i]), table);
+        }
+    }
+    else
+    {
+        for (usize limbs = 4; limbs <= CALIBRATED_MAX_LIMBS; limbs++)
+        {
+            calibrate(limbs, table);
+        }
+    }
+
+    print_table(table);
+}